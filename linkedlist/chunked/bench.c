@@ -0,0 +1,79 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "chunkedlist.h"
+#include "../doublylinked/dlinkedlist.h"
+
+// Compilar com:
+//   gcc -O2 bench.c chunkedlist.c ../doublylinked/dlinkedlist.c
+
+#define DLSTOPS 2000
+#define CLSTOPS 1000000
+
+double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+// Pares inserção/remoção em posições aleatórias; o tamanho da
+// sequência se mantém em n.
+double benchdlst(int n, int ops) {
+    Dlist *lst = createdlst();
+    double t0;
+    int i;
+
+    for (i = 0; i < n; i++) insertlastdlst(lst, dlstinfo(i));
+    t0 = now();
+    for (i = 0; i < ops; i++) {
+        insertposdlst(lst, dlstinfo(i), rand() % (n + 1) + 1);
+        free(delposdlst(lst, rand() % (n + 1) + 1));
+    }
+    t0 = now() - t0;
+    destroydlst(lst);
+    return t0 / (2.0 * ops);
+}
+
+double benchclst(int n, int ops) {
+    Clist *lst = createclst();
+    double t0;
+    int i;
+
+    for (i = 0; i < n; i++) insertposclst(lst, i, i + 1);
+    t0 = now();
+    for (i = 0; i < ops; i++) {
+        insertposclst(lst, i, rand() % (n + 1) + 1);
+        delposclst(lst, rand() % (n + 1) + 1, NULL);
+    }
+    t0 = now() - t0;
+    destroyclst(lst);
+    return t0 / (2.0 * ops);
+}
+
+int main() {
+    int sizes[] = { 10000, 100000, 1000000, 10000000 };
+    double td, tc;
+    int s;
+
+    srand(42);
+    printf("%9s %16s %16s %9s\n", "n", "Dlist us/op", "Clist us/op", "speedup");
+
+    for (s = 0; s < 4; s++) {
+        // Dlist com 10M elementos leva minutos; mede apenas Clist.
+        td = sizes[s] <= 1000000 ? benchdlst(sizes[s], DLSTOPS) : 0;
+        tc = benchclst(sizes[s], CLSTOPS);
+        if (td > 0) printf("%9d %16.3f %16.3f %8.0fx\n", sizes[s], td * 1e6, tc * 1e6, td / tc);
+        else printf("%9d %16s %16.3f %9s\n", sizes[s], "-", tc * 1e6, "-");
+    }
+    return 0;
+}
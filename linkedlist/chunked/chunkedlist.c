@@ -0,0 +1,367 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "chunkedlist.h"
+
+/**
+ * Soma dos tamanhos de uma subárvore.
+ *
+ * @param chunk ponteiro ChunkClist da raiz da subárvore, ou NULL.
+ * @return int quantidade de valores na subárvore.
+ */
+static int sumclst(ChunkClist *chunk) {
+    return chunk ? chunk->sum : 0;
+}
+
+/**
+ * Sorteia prioridade de um novo bloco.
+ *
+ * Gerador xorshift próprio da sequência, para não alterar o
+ * estado de rand usado pelo chamador.
+ *
+ * @param lst ponteiro Clist da sequência.
+ * @return unsigned prioridade.
+ */
+static unsigned priorityclst(Clist *lst) {
+    lst->seed ^= lst->seed << 13;
+    lst->seed ^= lst->seed >> 17;
+    lst->seed ^= lst->seed << 5;
+    return lst->seed;
+}
+
+/**
+ * Soma delta ao tamanho de um bloco.
+ *
+ * Atualiza count do bloco e sum de todos os seus ancestrais.
+ *
+ * @param chunk ponteiro ChunkClist do bloco.
+ * @param delta variação do tamanho.
+ */
+static void addclst(ChunkClist *chunk, int delta) {
+    chunk->count += delta;
+    for (; chunk; chunk = chunk->parent) chunk->sum += delta;
+}
+
+/**
+ * Rotaciona um bloco acima de seu pai.
+ *
+ * Preserva a ordem dos blocos e refaz as somas dos dois nós
+ * envolvidos; as dos demais ancestrais não mudam.
+ *
+ * @param lst ponteiro Clist da sequência.
+ * @param x ponteiro ChunkClist com pai.
+ */
+static void rotateclst(Clist *lst, ChunkClist *x) {
+    ChunkClist *p = x->parent, *g = p->parent;
+
+    if (x == p->left) {
+        p->left = x->right;
+        if (x->right) x->right->parent = p;
+        x->right = p;
+    }
+    else {
+        p->right = x->left;
+        if (x->left) x->left->parent = p;
+        x->left = p;
+    }
+    p->parent = x;
+    x->parent = g;
+    if (!g) lst->root = x;
+    else if (g->left == p) g->left = x;
+    else g->right = x;
+
+    x->sum = p->sum;
+    p->sum = p->count + sumclst(p->left) + sumclst(p->right);
+}
+
+/**
+ * Localiza bloco de uma posição.
+ *
+ * Desce a árvore a partir da raiz, descontando de pos os valores
+ * dos blocos que ficam à esquerda.
+ *
+ * @param lst ponteiro Clist da sequência.
+ * @param pos posição entre 1 e lst->size; recebe o deslocamento
+ *            (base 0) dentro do bloco.
+ * @return ChunkClist* pointer para o bloco.
+ */
+static ChunkClist *findclst(Clist *lst, int *pos) {
+    ChunkClist *chunk = lst->root;
+    int left;
+
+    for (;;) {
+        left = sumclst(chunk->left);
+        if (*pos <= left) chunk = chunk->left;
+        else if (*pos <= left + chunk->count) break;
+        else {
+            *pos -= left + chunk->count;
+            chunk = chunk->right;
+        }
+    }
+    *pos -= left + 1;
+    return chunk;
+}
+
+/**
+ * Insere bloco vazio depois de outro.
+ *
+ * O novo bloco entra como folha, na posição do sucessor em ordem
+ * de at, e sobe por rotações enquanto sua prioridade for maior
+ * que a do pai.
+ *
+ * @param lst ponteiro Clist da sequência.
+ * @param at ponteiro ChunkClist que precederá o novo bloco, ou
+ *           NULL para o primeiro bloco de uma sequência sem blocos.
+ * @return ChunkClist* pointer para o bloco criado, ou NULL caso falhe.
+ */
+static ChunkClist *newchunkclst(Clist *lst, ChunkClist *at) {
+    ChunkClist *chunk;
+
+    chunk = (ChunkClist *) malloc(sizeof(ChunkClist));
+    if (!chunk) return NULL;
+    chunk->count = chunk->sum = 0;
+    chunk->left = chunk->right = NULL;
+    chunk->priority = priorityclst(lst);
+
+    chunk->parent = NULL;
+    if (!at) lst->root = chunk;
+    else if (!at->right) {
+        at->right = chunk;
+        chunk->parent = at;
+    }
+    else {
+        // Sucessor de at: o mais à esquerda da subárvore direita.
+        at->next->left = chunk;
+        chunk->parent = at->next;
+    }
+
+    chunk->prev = at;
+    chunk->next = at ? at->next : NULL;
+    if (chunk->next) chunk->next->prev = chunk;
+    else lst->last = chunk;
+    if (at) at->next = chunk;
+    else lst->first = chunk;
+
+    while (chunk->parent && chunk->parent->priority < chunk->priority) rotateclst(lst, chunk);
+    return chunk;
+}
+
+/**
+ * Remove bloco vazio da sequência de blocos.
+ *
+ * O bloco desce por rotações até virar folha e então é desligado.
+ *
+ * @param lst ponteiro Clist da sequência.
+ * @param chunk ponteiro ChunkClist com count igual a zero.
+ */
+static void delchunkclst(Clist *lst, ChunkClist *chunk) {
+    ChunkClist *child;
+
+    while (chunk->left || chunk->right) {
+        if (!chunk->right || (chunk->left && chunk->left->priority > chunk->right->priority)) child = chunk->left;
+        else child = chunk->right;
+        rotateclst(lst, child);
+    }
+    if (!chunk->parent) lst->root = NULL;
+    else if (chunk->parent->left == chunk) chunk->parent->left = NULL;
+    else chunk->parent->right = NULL;
+
+    if (chunk->prev) chunk->prev->next = chunk->next;
+    else lst->first = chunk->next;
+    if (chunk->next) chunk->next->prev = chunk->prev;
+    else lst->last = chunk->prev;
+    free(chunk);
+}
+
+/**
+ * Cria sequência vazia.
+ *
+ * @return Clist* pointer para sequência criada, ou NULL caso falhe.
+ */
+Clist *createclst() {
+    Clist *lst;
+
+    lst = (Clist *) malloc(sizeof(Clist));
+    if (lst) {
+        lst->size = 0;
+        lst->root = lst->first = lst->last = NULL;
+        lst->seed = 2463534242u;
+        return lst;
+    }
+    return NULL;
+}
+
+/**
+ * Destroi sequência.
+ *
+ * @param lst ponteiro Clist da sequência.
+ */
+void destroyclst(Clist *lst) {
+    ChunkClist *chunk, *next;
+
+    if (!lst) return;
+    for (chunk = lst->first; chunk; chunk = next) {
+        next = chunk->next;
+        free(chunk);
+    }
+    free(lst);
+}
+
+/**
+ * Verifica se sequência está vazia.
+ *
+ * @param lst ponteiro Clist da sequência.
+ * @return int 1 caso vazia, 0 caso contrário.
+ */
+int isemptyclst(Clist *lst) {
+    return (!lst || lst->size == 0);
+}
+
+/**
+ * Ver tamanho da sequência.
+ *
+ * @param lst ponteiro Clist da sequência.
+ * @return int quantidade de valores, -1 caso sequência não exista.
+ */
+int lenclst(Clist *lst) {
+    if (!lst) return -1;
+    return lst->size;
+}
+
+/**
+ * Insere valor em uma posição da sequência.
+ *
+ * O valor passa a ocupar a posição pos, deslocando o que estava
+ * nela. Posições menores que 1 inserem no início e maiores que o
+ * tamanho da sequência inserem no final.
+ *
+ * @param lst ponteiro Clist da sequência.
+ * @param value valor a ser inserido.
+ * @param pos posição para inserir o valor.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertposclst(Clist *lst, int value, int pos) {
+    ChunkClist *chunk, *half;
+    int off;
+
+    if (!lst) return 0;
+    if (pos < 1) pos = 1;
+
+    if (!lst->root && !newchunkclst(lst, NULL)) return 0;
+
+    if (pos > lst->size) {
+        chunk = lst->last;
+        off = chunk->count;
+    }
+    else {
+        off = pos;
+        chunk = findclst(lst, &off);
+    }
+
+    // Bloco cheio: metade superior vai para um novo bloco.
+    if (chunk->count == CLST_CHUNK) {
+        half = newchunkclst(lst, chunk);
+        if (!half) return 0;
+        memcpy(half->values, &chunk->values[CLST_CHUNK - CLST_CHUNK / 2], CLST_CHUNK / 2 * sizeof(int));
+        addclst(chunk, -(CLST_CHUNK / 2));
+        addclst(half, CLST_CHUNK / 2);
+        if (off > chunk->count) {
+            off -= chunk->count;
+            chunk = half;
+        }
+    }
+
+    memmove(&chunk->values[off + 1], &chunk->values[off], (chunk->count - off) * sizeof(int));
+    chunk->values[off] = value;
+    addclst(chunk, 1);
+    lst->size++;
+    return 1;
+}
+
+/**
+ * Remove valor em uma posição da sequência.
+ *
+ * @param lst ponteiro Clist da sequência.
+ * @param pos posição a ser removida, entre 1 e o tamanho.
+ * @param value ponteiro que recebe o valor removido, ou NULL.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int delposclst(Clist *lst, int pos, int *value) {
+    ChunkClist *chunk, *next, *prev;
+    int off, moved;
+
+    if (isemptyclst(lst) || pos < 1 || pos > lst->size) return 0;
+
+    off = pos;
+    chunk = findclst(lst, &off);
+
+    if (value) *value = chunk->values[off];
+    memmove(&chunk->values[off], &chunk->values[off + 1], (chunk->count - off - 1) * sizeof(int));
+    addclst(chunk, -1);
+    lst->size--;
+
+    // Funde blocos vizinhos que caibam em meio bloco.
+    next = chunk->next;
+    prev = chunk->prev;
+    if (next && chunk->count + next->count <= CLST_CHUNK / 2) {
+        moved = next->count;
+        memcpy(&chunk->values[chunk->count], next->values, moved * sizeof(int));
+        addclst(next, -moved);
+        addclst(chunk, moved);
+        delchunkclst(lst, next);
+    }
+    else if (prev && chunk->count + prev->count <= CLST_CHUNK / 2) {
+        moved = chunk->count;
+        memcpy(&prev->values[prev->count], chunk->values, moved * sizeof(int));
+        addclst(chunk, -moved);
+        addclst(prev, moved);
+        delchunkclst(lst, chunk);
+    }
+    else if (chunk->count == 0) delchunkclst(lst, chunk);
+    return 1;
+}
+
+/**
+ * Consulta valor em uma posição da sequência.
+ *
+ * O ponteiro retornado permite alterar o valor e deixa de ser
+ * válido na próxima inserção ou remoção.
+ *
+ * @param lst ponteiro Clist da sequência.
+ * @param pos posição a ser consultada, entre 1 e o tamanho.
+ * @return int* pointer para o valor, ou NULL caso não exista.
+ */
+int *getposclst(Clist *lst, int pos) {
+    ChunkClist *chunk;
+
+    if (isemptyclst(lst) || pos < 1 || pos > lst->size) return NULL;
+
+    chunk = findclst(lst, &pos);
+    return &chunk->values[pos];
+}
+
+/**
+ * Imprime valores da sequência.
+ *
+ * @param lst ponteiro Clist da sequência.
+ */
+void printclst(Clist *lst) {
+    ChunkClist *chunk;
+    int j;
+
+    if (isemptyclst(lst)) return;
+
+    printf("\n[ ");
+    for (chunk = lst->first; chunk; chunk = chunk->next) {
+        for (j = 0; j < chunk->count; j++) printf("(%d) ", chunk->values[j]);
+    }
+    printf("]\n");
+}
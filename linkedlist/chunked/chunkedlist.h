@@ -0,0 +1,120 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef CHUNKEDLIST_H
+#define CHUNKEDLIST_H
+
+/**
+ * Capacidade de cada bloco, em valores.
+ */
+#ifndef CLST_CHUNK
+#define CLST_CHUNK 512
+#endif
+
+/**
+ * Estruturas de dados
+ *
+ * Sequência de inteiros dividida em blocos (chunks) de até
+ * CLST_CHUNK valores contíguos. Os blocos formam uma lista
+ * duplamente encadeada, na ordem da sequência, e ao mesmo tempo
+ * uma treap: árvore de busca pela ordem dos blocos, balanceada
+ * por prioridades aleatórias, em que cada bloco guarda a soma dos
+ * tamanhos da sua subárvore. Localizar o bloco de uma posição,
+ * dividir um bloco cheio e fundir blocos pequenos custam
+ * O(log n) esperado; dentro do bloco os valores são deslocados
+ * com memmove, em O(CLST_CHUNK).
+ */
+
+typedef struct tchunk {
+    struct tchunk *prev, *next;
+    struct tchunk *parent, *left, *right;
+    unsigned priority;
+    int sum, count;
+    int values[CLST_CHUNK];
+} ChunkClist;
+
+typedef struct {
+    int size;
+    ChunkClist *root, *first, *last;
+    unsigned seed;
+} Clist;
+
+/**
+ * Cria sequência vazia.
+ *
+ * @return Clist* pointer para sequência criada, ou NULL caso falhe.
+ */
+Clist *createclst();
+
+/**
+ * Destroi sequência.
+ *
+ * @param lst ponteiro Clist da sequência.
+ */
+void destroyclst(Clist *lst);
+
+/**
+ * Verifica se sequência está vazia.
+ *
+ * @param lst ponteiro Clist da sequência.
+ * @return int 1 caso vazia, 0 caso contrário.
+ */
+int isemptyclst(Clist *lst);
+
+/**
+ * Ver tamanho da sequência.
+ *
+ * @param lst ponteiro Clist da sequência.
+ * @return int quantidade de valores, -1 caso sequência não exista.
+ */
+int lenclst(Clist *lst);
+
+/**
+ * Insere valor em uma posição da sequência.
+ *
+ * O valor passa a ocupar a posição pos, deslocando o que estava
+ * nela. Posições menores que 1 inserem no início e maiores que o
+ * tamanho da sequência inserem no final.
+ *
+ * @param lst ponteiro Clist da sequência.
+ * @param value valor a ser inserido.
+ * @param pos posição para inserir o valor.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertposclst(Clist *lst, int value, int pos);
+
+/**
+ * Remove valor em uma posição da sequência.
+ *
+ * @param lst ponteiro Clist da sequência.
+ * @param pos posição a ser removida, entre 1 e o tamanho.
+ * @param value ponteiro que recebe o valor removido, ou NULL.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int delposclst(Clist *lst, int pos, int *value);
+
+/**
+ * Consulta valor em uma posição da sequência.
+ *
+ * O ponteiro retornado permite alterar o valor e deixa de ser
+ * válido na próxima inserção ou remoção.
+ *
+ * @param lst ponteiro Clist da sequência.
+ * @param pos posição a ser consultada, entre 1 e o tamanho.
+ * @return int* pointer para o valor, ou NULL caso não exista.
+ */
+int *getposclst(Clist *lst, int pos);
+
+/**
+ * Imprime valores da sequência.
+ *
+ * @param lst ponteiro Clist da sequência.
+ */
+void printclst(Clist *lst);
+
+#endif
@@ -0,0 +1,41 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include "chunkedlist.h"
+
+// dummy test
+int main() {
+    Clist *lst = createclst();
+    int i, value;
+
+    // Insere no final, no início e no meio.
+    // Output: [ (0) (1) (9) (2) (3) ]
+    insertposclst(lst, 1, 1);
+    insertposclst(lst, 2, 2);
+    insertposclst(lst, 3, 10);
+    insertposclst(lst, 0, 0);
+    insertposclst(lst, 9, 3);
+    printclst(lst);
+
+    // Remove a terceira posição e altera a primeira.
+    // Output: [ (7) (1) (2) (3) ], removido 9
+    delposclst(lst, 3, &value);
+    *getposclst(lst, 1) = 7;
+    printclst(lst);
+    printf("removido %d\n", value);
+
+    // Sequência maior que um bloco.
+    // Output: 2000 valores, posição 1500: 1499
+    for (i = 0; i < 2000; i++) insertposclst(lst, i, i + 1);
+    for (i = 0; i < 4; i++) delposclst(lst, lenclst(lst), NULL);
+    printf("%d valores, posição 1500: %d\n", lenclst(lst), *getposclst(lst, 1500));
+
+    destroyclst(lst);
+    return 0;
+}
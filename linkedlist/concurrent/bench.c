@@ -0,0 +1,113 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "cdlinkedlist.h"
+#include "../doublylinked/dlinkedlist.h"
+
+#define MAXTHREADS 64
+#define SIZE 4096
+#define OPS 100000
+
+// Compilar com:
+//   gcc -O2 -pthread bench.c cdlinkedlist.c ../doublylinked/dlinkedlist.c
+
+typedef struct {
+    int kind;               // 0 Cdlist, 1 Dlist + mutex
+    int first, width;       // região de posições da thread
+    unsigned seed;
+} Job;
+
+Cdlist *cdlst;
+Dlist *dlst;
+pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+unsigned xorshift(unsigned *s) {
+    *s ^= *s << 13;
+    *s ^= *s >> 17;
+    *s ^= *s << 5;
+    return *s;
+}
+
+// Pares inserção/remoção na região da thread; o tamanho se mantém.
+void *worker(void *arg) {
+    Job *job = (Job *) arg;
+    int i, pos;
+
+    for (i = 0; i < OPS; i++) {
+        pos = job->first + xorshift(&job->seed) % job->width;
+        if (job->kind == 0) {
+            insertposcdlst(cdlst, i, pos);
+            delposcdlst(cdlst, pos, NULL);
+        }
+        else {
+            pthread_mutex_lock(&mutex);
+            insertposdlst(dlst, dlstinfo(i), pos);
+            free(delposdlst(dlst, pos));
+            pthread_mutex_unlock(&mutex);
+        }
+    }
+    return NULL;
+}
+
+double run(int kind, int nthreads) {
+    pthread_t threads[MAXTHREADS];
+    Job jobs[MAXTHREADS];
+    struct timespec t0, t1;
+    int i;
+
+    if (kind == 0) {
+        cdlst = createcdlst();
+        for (i = 0; i < SIZE; i++) insertposcdlst(cdlst, i, i + 1);
+    }
+    else {
+        dlst = createdlst();
+        for (i = 0; i < SIZE; i++) insertlastdlst(dlst, dlstinfo(i));
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (i = 0; i < nthreads; i++) {
+        jobs[i].kind = kind;
+        jobs[i].width = SIZE / nthreads;
+        jobs[i].first = i * jobs[i].width + 1;
+        jobs[i].seed = 2463534242u + i * 7919;
+        pthread_create(&threads[i], NULL, worker, &jobs[i]);
+    }
+    for (i = 0; i < nthreads; i++) pthread_join(threads[i], NULL);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    if (kind == 0) destroycdlst(cdlst);
+    else destroydlst(dlst);
+
+    return 2.0 * nthreads * OPS /
+           ((t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9);
+}
+
+int main() {
+    int ncpu, nthreads;
+
+    ncpu = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    if (ncpu < 1) ncpu = 1;
+    if (ncpu > MAXTHREADS) ncpu = MAXTHREADS;
+
+    printf("%d nós, cada thread opera em uma faixa própria de posições\n", SIZE);
+    printf("%8s %18s %18s\n", "threads", "lock coupling op/s", "mutex global op/s");
+
+    for (nthreads = 1; ; nthreads *= 2) {
+        if (nthreads > ncpu) nthreads = ncpu;
+        printf("%8d %18.0f %18.0f\n", nthreads, run(0, nthreads), run(1, nthreads));
+        if (nthreads == ncpu) break;
+    }
+    return 0;
+}
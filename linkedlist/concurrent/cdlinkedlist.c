@@ -0,0 +1,259 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "cdlinkedlist.h"
+
+/**
+ * Percorre a lista até uma posição.
+ *
+ * Trava a cabeça e avança por lock coupling até que pred seja o
+ * nó da posição pos - 1 (ou o último nó, caso a lista seja menor).
+ * Retorna com pred e pred->next travados.
+ *
+ * @param lst ponteiro Cdlist da lista.
+ * @param pos posição desejada (maior que zero).
+ * @return NodeCdlist* pointer para pred, travado.
+ */
+static NodeCdlist *walkcdlst(Cdlist *lst, int pos) {
+    NodeCdlist *pred, *curr;
+    int i;
+
+    pred = &lst->head;
+    pthread_mutex_lock(&pred->lock);
+    curr = pred->next;
+    pthread_mutex_lock(&curr->lock);
+
+    for (i = 1; i < pos && curr != &lst->tail; i++) {
+        pthread_mutex_unlock(&pred->lock);
+        pred = curr;
+        curr = curr->next;
+        pthread_mutex_lock(&curr->lock);
+    }
+    return pred;
+}
+
+/**
+ * Cria cabeça de lista.
+ *
+ * @return Cdlist* pointer para lista criada, ou NULL caso falhe.
+ */
+Cdlist *createcdlst() {
+    Cdlist *lst;
+
+    lst = (Cdlist *) malloc(sizeof(Cdlist));
+    if (!lst) return NULL;
+
+    lst->head.next = &lst->tail;
+    lst->head.prev = NULL;
+    lst->tail.next = NULL;
+    lst->tail.prev = &lst->head;
+    pthread_mutex_init(&lst->head.lock, NULL);
+    pthread_mutex_init(&lst->tail.lock, NULL);
+    atomic_init(&lst->size, 0);
+    return lst;
+}
+
+/**
+ * Destroi lista.
+ *
+ * Não deve ser chamada com outras threads usando a lista.
+ *
+ * @param lst ponteiro Cdlist da lista.
+ */
+void destroycdlst(Cdlist *lst) {
+    NodeCdlist *ptr, *next;
+
+    if (!lst) return;
+
+    for (ptr = lst->head.next; ptr != &lst->tail; ptr = next) {
+        next = ptr->next;
+        pthread_mutex_destroy(&ptr->lock);
+        free(ptr);
+    }
+    pthread_mutex_destroy(&lst->head.lock);
+    pthread_mutex_destroy(&lst->tail.lock);
+    free(lst);
+}
+
+/**
+ * Ver tamanho da lista.
+ *
+ * Com operações em andamento o valor é apenas aproximado.
+ *
+ * @param lst ponteiro Cdlist da lista.
+ * @return int quantidade de elementos, -1 caso lista não exista.
+ */
+int lencdlst(Cdlist *lst) {
+    if (!lst) return -1;
+    return atomic_load(&lst->size);
+}
+
+/**
+ * Insere valor em uma posição da lista.
+ *
+ * Mesma semântica de insertposdlst: o valor passa a ocupar a
+ * posição pos; posições menores que 1 inserem no início e maiores
+ * que o tamanho inserem no final.
+ *
+ * @param lst ponteiro Cdlist da lista.
+ * @param value valor a ser inserido.
+ * @param pos posição para inserir o valor.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertposcdlst(Cdlist *lst, int value, int pos) {
+    NodeCdlist *node, *pred, *succ;
+
+    if (!lst) return 0;
+
+    node = (NodeCdlist *) malloc(sizeof(NodeCdlist));
+    if (!node) return 0;
+    node->value = value;
+    pthread_mutex_init(&node->lock, NULL);
+
+    pred = walkcdlst(lst, pos < 1 ? 1 : pos);
+    succ = pred->next;
+
+    node->prev = pred;
+    node->next = succ;
+    pred->next = node;
+    succ->prev = node;
+    atomic_fetch_add(&lst->size, 1);
+
+    pthread_mutex_unlock(&succ->lock);
+    pthread_mutex_unlock(&pred->lock);
+    return 1;
+}
+
+/**
+ * Remove elemento em uma posição da lista.
+ *
+ * @param lst ponteiro Cdlist da lista.
+ * @param pos posição a ser removida.
+ * @param value ponteiro que recebe o valor removido, ou NULL.
+ * @return int 1 para sucesso, 0 caso a posição não exista.
+ */
+int delposcdlst(Cdlist *lst, int pos, int *value) {
+    NodeCdlist *pred, *node, *succ;
+
+    if (!lst || pos < 1) return 0;
+
+    pred = walkcdlst(lst, pos);
+    node = pred->next;
+    if (node == &lst->tail) {
+        pthread_mutex_unlock(&node->lock);
+        pthread_mutex_unlock(&pred->lock);
+        return 0;
+    }
+
+    // O sucessor também é alterado (prev) e precisa ser travado.
+    succ = node->next;
+    pthread_mutex_lock(&succ->lock);
+
+    pred->next = succ;
+    succ->prev = pred;
+    atomic_fetch_sub(&lst->size, 1);
+    if (value) *value = node->value;
+
+    pthread_mutex_unlock(&succ->lock);
+    pthread_mutex_unlock(&node->lock);
+    pthread_mutex_unlock(&pred->lock);
+
+    // Nenhuma outra thread espera por node: para alcançá-lo seria
+    // preciso travar pred, que estava travado durante a remoção.
+    pthread_mutex_destroy(&node->lock);
+    free(node);
+    return 1;
+}
+
+/**
+ * Consulta elemento em uma posição da lista.
+ *
+ * @param lst ponteiro Cdlist da lista.
+ * @param pos posição a ser consultada.
+ * @param value ponteiro que recebe o valor.
+ * @return int 1 para sucesso, 0 caso a posição não exista.
+ */
+int getposcdlst(Cdlist *lst, int pos, int *value) {
+    NodeCdlist *pred, *node;
+    int found = 0;
+
+    if (!lst || pos < 1) return 0;
+
+    pred = walkcdlst(lst, pos);
+    node = pred->next;
+    if (node != &lst->tail) {
+        if (value) *value = node->value;
+        found = 1;
+    }
+    pthread_mutex_unlock(&node->lock);
+    pthread_mutex_unlock(&pred->lock);
+    return found;
+}
+
+/**
+ * Encontra valor na lista.
+ *
+ * @param lst ponteiro Cdlist da lista.
+ * @param value valor a ser buscado.
+ * @return int posição da primeira ocorrência, -1 caso não exista.
+ */
+int findcdlst(Cdlist *lst, int value) {
+    NodeCdlist *pred, *curr;
+    int pos;
+
+    if (!lst) return -1;
+
+    pred = &lst->head;
+    pthread_mutex_lock(&pred->lock);
+    curr = pred->next;
+    pthread_mutex_lock(&curr->lock);
+
+    for (pos = 1; curr != &lst->tail; pos++) {
+        if (curr->value == value) break;
+        pthread_mutex_unlock(&pred->lock);
+        pred = curr;
+        curr = curr->next;
+        pthread_mutex_lock(&curr->lock);
+    }
+    if (curr == &lst->tail) pos = -1;
+
+    pthread_mutex_unlock(&curr->lock);
+    pthread_mutex_unlock(&pred->lock);
+    return pos;
+}
+
+/**
+ * Imprime elementos de lista.
+ *
+ * @param lst ponteiro Cdlist da lista.
+ */
+void printcdlst(Cdlist *lst) {
+    NodeCdlist *pred, *curr;
+
+    if (!lst) return;
+
+    pred = &lst->head;
+    pthread_mutex_lock(&pred->lock);
+    curr = pred->next;
+    pthread_mutex_lock(&curr->lock);
+
+    printf("\n[ ");
+    while (curr != &lst->tail) {
+        printf("(%d) ", curr->value);
+        pthread_mutex_unlock(&pred->lock);
+        pred = curr;
+        curr = curr->next;
+        pthread_mutex_lock(&curr->lock);
+    }
+    printf("]\n");
+
+    pthread_mutex_unlock(&curr->lock);
+    pthread_mutex_unlock(&pred->lock);
+}
@@ -0,0 +1,113 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef CDLINKEDLIST_H
+#define CDLINKEDLIST_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+/**
+ * Estruturas de dados
+ *
+ * Lista duplamente encadeada concorrente com uma trava por nó.
+ * As operações percorrem a lista a partir da cabeça travando o
+ * próximo nó antes de soltar o anterior (lock coupling), sempre no
+ * sentido first -> last, o que impede impasses. Operações em
+ * regiões diferentes da lista avançam em paralelo, uma atrás da
+ * outra. head e tail são sentinelas e nunca são removidos.
+ */
+
+typedef struct cdnode {
+    int value;
+    struct cdnode *next, *prev;
+    pthread_mutex_t lock;
+} NodeCdlist;
+
+typedef struct {
+    NodeCdlist head, tail;
+    _Atomic int size;
+} Cdlist;
+
+/**
+ * Cria cabeça de lista.
+ *
+ * @return Cdlist* pointer para lista criada, ou NULL caso falhe.
+ */
+Cdlist *createcdlst();
+
+/**
+ * Destroi lista.
+ *
+ * Não deve ser chamada com outras threads usando a lista.
+ *
+ * @param lst ponteiro Cdlist da lista.
+ */
+void destroycdlst(Cdlist *lst);
+
+/**
+ * Ver tamanho da lista.
+ *
+ * Com operações em andamento o valor é apenas aproximado.
+ *
+ * @param lst ponteiro Cdlist da lista.
+ * @return int quantidade de elementos, -1 caso lista não exista.
+ */
+int lencdlst(Cdlist *lst);
+
+/**
+ * Insere valor em uma posição da lista.
+ *
+ * Mesma semântica de insertposdlst: o valor passa a ocupar a
+ * posição pos; posições menores que 1 inserem no início e maiores
+ * que o tamanho inserem no final.
+ *
+ * @param lst ponteiro Cdlist da lista.
+ * @param value valor a ser inserido.
+ * @param pos posição para inserir o valor.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertposcdlst(Cdlist *lst, int value, int pos);
+
+/**
+ * Remove elemento em uma posição da lista.
+ *
+ * @param lst ponteiro Cdlist da lista.
+ * @param pos posição a ser removida.
+ * @param value ponteiro que recebe o valor removido, ou NULL.
+ * @return int 1 para sucesso, 0 caso a posição não exista.
+ */
+int delposcdlst(Cdlist *lst, int pos, int *value);
+
+/**
+ * Consulta elemento em uma posição da lista.
+ *
+ * @param lst ponteiro Cdlist da lista.
+ * @param pos posição a ser consultada.
+ * @param value ponteiro que recebe o valor.
+ * @return int 1 para sucesso, 0 caso a posição não exista.
+ */
+int getposcdlst(Cdlist *lst, int pos, int *value);
+
+/**
+ * Encontra valor na lista.
+ *
+ * @param lst ponteiro Cdlist da lista.
+ * @param value valor a ser buscado.
+ * @return int posição da primeira ocorrência, -1 caso não exista.
+ */
+int findcdlst(Cdlist *lst, int value);
+
+/**
+ * Imprime elementos de lista.
+ *
+ * @param lst ponteiro Cdlist da lista.
+ */
+void printcdlst(Cdlist *lst);
+
+#endif
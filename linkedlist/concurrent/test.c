@@ -0,0 +1,97 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include <pthread.h>
+#include "cdlinkedlist.h"
+
+#define NTHREADS 4
+#define PERTHREAD 20000
+#define PRELOAD 256
+
+Cdlist *shared;
+_Atomic int inserted, removed;
+
+unsigned xorshift(unsigned *s) {
+    *s ^= *s << 13;
+    *s ^= *s >> 17;
+    *s ^= *s << 5;
+    return *s;
+}
+
+// Inserções, remoções e consultas em posições aleatórias.
+void *worker(void *arg) {
+    int id = (int) (long) arg;
+    unsigned seed = 2463534242u + id * 7919;
+    int i, r, pos, value;
+
+    for (i = 0; i < PERTHREAD; i++) {
+        r = xorshift(&seed) % 4;
+        pos = xorshift(&seed) % (PRELOAD + 2) + 1;
+        if (r < 2) {
+            if (insertposcdlst(shared, id * PERTHREAD + i, pos)) atomic_fetch_add(&inserted, 1);
+        }
+        else if (r == 2) {
+            if (delposcdlst(shared, pos, &value)) atomic_fetch_add(&removed, 1);
+        }
+        else getposcdlst(shared, pos, &value);
+    }
+    return NULL;
+}
+
+// Confere next/prev de todos os nós e a quantidade contada.
+int checkcdlst(Cdlist *lst, int expected) {
+    NodeCdlist *ptr;
+    int count = 0;
+
+    if (lst->head.prev || lst->tail.next) return 0;
+    for (ptr = &lst->head; ptr != &lst->tail; ptr = ptr->next) {
+        if (!ptr->next || ptr->next->prev != ptr) return 0;
+        if (ptr != &lst->head) count++;
+    }
+    return count == expected && lencdlst(lst) == expected;
+}
+
+// dummy test
+int main() {
+    pthread_t threads[NTHREADS];
+    int i, value, ok;
+
+    shared = createcdlst();
+
+    // Mesma semântica de posição de insertposdlst.
+    // Output: [ (0) (1) (9) (2) (3) ]
+    insertposcdlst(shared, 1, 1);
+    insertposcdlst(shared, 2, 2);
+    insertposcdlst(shared, 3, 10);
+    insertposcdlst(shared, 0, 0);
+    insertposcdlst(shared, 9, 3);
+    printcdlst(shared);
+
+    // Remove a terceira posição e busca valores.
+    // Output: [ (0) (1) (2) (3) ], removido 9, posição de 2: 3, de 9: -1
+    delposcdlst(shared, 3, &value);
+    printcdlst(shared);
+    printf("removido %d, posição de 2: %d, de 9: %d\n", value, findcdlst(shared, 2), findcdlst(shared, 9));
+
+    while (delposcdlst(shared, 1, NULL));
+    for (i = 0; i < PRELOAD; i++) insertposcdlst(shared, -1, i + 1);
+    atomic_init(&inserted, PRELOAD);
+    atomic_init(&removed, 0);
+
+    // Operações concorrentes em posições aleatórias.
+    for (i = 0; i < NTHREADS; i++) pthread_create(&threads[i], NULL, worker, (void *) (long) i);
+    for (i = 0; i < NTHREADS; i++) pthread_join(threads[i], NULL);
+
+    // Output: next/prev consistentes: 1
+    ok = checkcdlst(shared, atomic_load(&inserted) - atomic_load(&removed));
+    printf("next/prev consistentes: %d\n", ok);
+
+    destroycdlst(shared);
+    return !ok;
+}
@@ -0,0 +1,76 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "dlinkedlist.h"
+
+// Compilar com:
+//   gcc -O2 bench_reverse.c dlinkedlist.c
+
+#define ROUNDS 1000
+
+double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+// Inversão anterior, religando todos os nós.
+void relinkreverse(Dlist *lst) {
+    NodeDlist *prev = NULL, *current, *next;
+
+    current = lst->first;
+    while (current != NULL) {
+        next = current->next;
+        current->next = prev;
+        current->prev = next;
+        prev = current;
+        current = next;
+    }
+    lst->last = lst->first;
+    lst->first = prev;
+}
+
+// Alterna entre as visões mais novo primeiro e mais antigo
+// primeiro, inserindo e removendo um elemento em cada visão.
+double workload(Dlist *lst, void (*reverse)(Dlist *)) {
+    double t0 = now();
+    int r;
+
+    for (r = 0; r < ROUNDS; r++) {
+        reverse(lst);
+        insertfirstdlst(lst, dlstinfo(r));
+        free(dellastdlst(lst));
+    }
+    return now() - t0;
+}
+
+int main() {
+    int sizes[] = { 1000, 10000, 100000, 1000000 };
+    double trelink, tflag;
+    Dlist *lst;
+    int s, i;
+
+    printf("%9s %16s %16s\n", "n", "religando us/op", "sentido us/op");
+
+    for (s = 0; s < 4; s++) {
+        lst = createdlst();
+        for (i = 0; i < sizes[s]; i++) insertlastdlst(lst, dlstinfo(i));
+
+        trelink = workload(lst, relinkreverse);
+        tflag = workload(lst, reversedlst);
+
+        printf("%9d %16.3f %16.3f\n", sizes[s], trelink / ROUNDS * 1e6, tflag / ROUNDS * 1e6);
+        destroydlst(lst);
+    }
+    return 0;
+}
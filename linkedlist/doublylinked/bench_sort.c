@@ -0,0 +1,83 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "pardlinkedlist.h"
+
+// Compilar com:
+//   gcc -O2 bench_sort.c pardlinkedlist.c dlinkedlist.c ../../threadpool/threadpool.c -pthread
+//
+// Uso: ./a.out [n]  (padrão: 5000000 elementos)
+
+double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+Dlist *randomdlst(int n) {
+    Dlist *lst = createdlst();
+    int i;
+
+    srand(42);
+    for (i = 0; i < n; i++) insertlastdlst(lst, dlstinfo(rand()));
+    reversedlst(lst);
+    return lst;
+}
+
+int issorteddlst(Dlist *lst) {
+    NodeDlist *ptr;
+    int count = 1;
+
+    if (isemptydlst(lst)) return 1;
+    for (ptr = lst->first; ptr->next; ptr = ptr->next, count++) {
+        if (ptr->next->info->value < ptr->info->value || ptr->next->prev != ptr) return 0;
+    }
+    return count == lst->size && ptr == lst->last;
+}
+
+int main(int argc, char **argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 5000000;
+    int ncpu = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    int counts[] = { 1, 2, 4, 8 };
+    int i, nthreads;
+    double t0, tseq;
+    ThreadPool *pool;
+    Dlist *lst;
+
+    if (ncpu < 1) ncpu = 1;
+
+    lst = randomdlst(n);
+    t0 = now();
+    mergesortdlst(lst);
+    tseq = now() - t0;
+    printf("n = %d\n", n);
+    printf("mergesortdlst: %.3f s%s\n", tseq, issorteddlst(lst) ? "" : " (fora de ordem!)");
+    destroydlst(lst);
+
+    printf("%8s %13s %8s\n", "threads", "sortpardlst s", "speedup");
+    for (i = 0; i <= 4; i++) {
+        nthreads = i < 4 ? counts[i] : ncpu;
+        if (i < 4 && nthreads >= ncpu) continue;
+
+        lst = randomdlst(n);
+        pool = createpool(nthreads);
+        t0 = now();
+        sortpardlst(pool, lst);
+        t0 = now() - t0;
+        printf("%8d %13.3f %7.2fx%s\n", nthreads, t0, tseq / t0, issorteddlst(lst) ? "" : " (fora de ordem!)");
+        destroypool(pool);
+        destroydlst(lst);
+    }
+    return 0;
+}
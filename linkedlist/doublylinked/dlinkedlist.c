@@ -9,6 +9,46 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "dlinkedlist.h"
+#include "../pfscan.h"
+
+/**
+ * Blocos de nós.
+ * 
+ * Nós realocados por relayoutdlst ficam em um único bloco; as
+ * informações continuam onde o chamador as alocou. Cada nó guarda
+ * o bloco a que pertence (NULL para nós alocados individualmente)
+ * e o bloco é liberado quando seu último nó é liberado.
+ */
+
+/**
+ * Aloca bloco de nós.
+ * 
+ * Aloca n nós em uma única chamada a malloc. Os nós já saem
+ * ligados em sequência nos dois sentidos e sem informação; cabe
+ * ao chamador atribuir as informações e ligá-los à lista.
+ * 
+ * @param n quantidade de nós (maior que zero).
+ * @return NodeDlist* pointer para o primeiro nó, ou NULL caso falhe.
+ */
+static NodeDlist *blockdlst(int n) {
+    BlockDlist *blk;
+    int i;
+
+    blk = (BlockDlist *) malloc(sizeof(BlockDlist) + n * sizeof(NodeDlist));
+    if (!blk) return NULL;
+
+    blk->nodes = (NodeDlist *) (blk + 1);
+    blk->capacity = blk->live = n;
+
+    for (i = 0; i < n; i++) {
+        blk->nodes[i].info = NULL;
+        blk->nodes[i].next = &blk->nodes[i + 1];
+        blk->nodes[i].prev = i ? &blk->nodes[i - 1] : NULL;
+        blk->nodes[i].block = blk;
+    }
+    blk->nodes[n - 1].next = NULL;
+    return blk->nodes;
+}
 
 /**
  * Cria cabeça de lista.
@@ -24,7 +64,8 @@ Dlist *createdlst() {
 
     if (ptr) {
         ptr->size = 0;
-        ptr->first = NULL;
+        ptr->first = ptr->last = NULL;
+        ptr->reversed = 0;
         return ptr;
     }
     return NULL;
@@ -55,7 +96,8 @@ NodeDlist *dlstnode() {
 
     if (ptr) {
         ptr->info = NULL;
-        ptr->next = NULL;
+        ptr->next = ptr->prev = NULL;
+        ptr->block = NULL;
         return ptr;
     }
     return NULL;
@@ -82,21 +124,67 @@ InfoDlist *dlstinfo(int i) {
 }
 
 /**
- * Insere nó no inicio da lista.
+ * Libera nó.
+ * 
+ * Substitui free para nós da lista. Um nó de bloco só devolve a
+ * memória quando o último nó vivo do bloco é liberado, o que
+ * permite a relayoutdlst mover nós sem copiar informações.
+ * 
+ * @param node ponteiro NodeDlist já desligado da lista.
+ */
+void freenodedlst(NodeDlist *node) {
+    if (!node->block) free(node);
+    else if (--node->block->live == 0) free(node->block);
+}
+
+/**
+ * Encontra nó em uma posição da lista.
+ * 
+ * Caminha a partir da extremidade mais próxima de pos, de forma
+ * que nenhuma busca percorre mais que metade da lista.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @param pos posição do nó, entre 1 e lst->size.
+ * @return NodeDlist* pointer para o nó na posição.
+ */
+static NodeDlist *nodeposdlst(Dlist *lst, int pos) {
+    NodeDlist *ptr;
+    int i;
+
+    if (pos <= lst->size / 2) {
+        for (i = 1, ptr = lst->first; i < pos; i++, ptr = ptr->next);
+    }
+    else {
+        for (i = lst->size, ptr = lst->last; i > pos; i--, ptr = ptr->prev);
+    }
+    return ptr;
+}
+
+/**
+ * Extremidades físicas.
+ * 
+ * As funções abaixo operam sobre first e last sem considerar o
+ * sentido da lista; as funções públicas escolhem a extremidade
+ * física conforme lst->reversed.
+ */
+
+/**
+ * Insere nó antes de first.
  * 
  * @param lst ponteiro Dlist da lista encadeada.
  * @param info ponteiro InfoDlist com informação a ser gravada em nó.
  * @return int 1 para sucesso, 0 caso contrário.
  */
-int insertfirstdlst(Dlist *lst, InfoDlist *info) {
+static int pushfrontdlst(Dlist *lst, InfoDlist *info) {
     NodeDlist *ptr;
     ptr = dlstnode();
 
-    if (!lst || !ptr) return 0;
+    if (!ptr) return 0;
 
     ptr->info = info;
     ptr->next = lst->first;
     if (ptr->next != NULL) ptr->next->prev = ptr;
+    else lst->last = ptr;
     lst->first = ptr;
 
     lst->size++;
@@ -104,31 +192,124 @@ int insertfirstdlst(Dlist *lst, InfoDlist *info) {
 }
 
 /**
- * Remove primeiro elemento da lista.
+ * Remove nó first.
  * 
- * @param lst ponteiro Dlist para lista encadeada.
+ * @param lst ponteiro Dlist não vazia.
  * @return InfoDlist* pointer do elemento removido, ou NULL caso falhe.
  */
-InfoDlist *delfirstdlst(Dlist *lst) {
+static InfoDlist *popfrontdlst(Dlist *lst) {
     NodeDlist *ptr;
     InfoDlist *info;
 
-    if (isemptydlst(lst)) return NULL;
-
     ptr = lst->first;
     lst->first = ptr->next;
     if (lst->first != NULL) lst->first->prev = NULL;
+    else lst->last = NULL;
     info = ptr->info;
 
+    freenodedlst(ptr);
+    lst->size--;
+    return info;
+}
 
-    free(ptr);
+/**
+ * Insere nó depois de last.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @param info ponteiro InfoDlist com informação a ser gravada em nó.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+static int pushbackdlst(Dlist *lst, InfoDlist *info) {
+    NodeDlist *ptr;
+
+    ptr = dlstnode();
+    if (!ptr) return 0;
+
+    ptr->info = info;
+    ptr->prev = lst->last;
+    if (ptr->prev != NULL) ptr->prev->next = ptr;
+    else lst->first = ptr;
+    lst->last = ptr;
+
+    lst->size++;
+    return 1;
+}
+
+/**
+ * Remove nó last.
+ * 
+ * @param lst ponteiro Dlist não vazia.
+ * @return InfoDlist* pointer do elemento removido, ou NULL caso falhe.
+ */
+static InfoDlist *popbackdlst(Dlist *lst) {
+    NodeDlist *ptr;
+    InfoDlist *info;
+
+    ptr = lst->last;
+    lst->last = ptr->prev;
+    if (lst->last != NULL) lst->last->next = NULL;
+    else lst->first = NULL;
+    info = ptr->info;
+
+    freenodedlst(ptr);
     lst->size--;
     return info;
 }
 
+/**
+ * Insere nó no inicio da lista.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @param info ponteiro InfoDlist com informação a ser gravada em nó.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertfirstdlst(Dlist *lst, InfoDlist *info) {
+    if (!lst) return 0;
+    return lst->reversed ? pushbackdlst(lst, info) : pushfrontdlst(lst, info);
+}
+
+/**
+ * Remove primeiro elemento da lista.
+ * 
+ * @param lst ponteiro Dlist para lista encadeada.
+ * @return InfoDlist* pointer do elemento removido, ou NULL caso falhe.
+ */
+InfoDlist *delfirstdlst(Dlist *lst) {
+    if (isemptydlst(lst)) return NULL;
+    return lst->reversed ? popbackdlst(lst) : popfrontdlst(lst);
+}
+
+/**
+ * Insere nó no final da lista.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @param info ponteiro InfoDlist com informação a ser gravada em nó.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertlastdlst(Dlist *lst, InfoDlist *info) {
+    if (!lst) return 0;
+    return lst->reversed ? pushfrontdlst(lst, info) : pushbackdlst(lst, info);
+}
+
+/**
+ * Remove último elemento da lista.
+ * 
+ * @param lst ponteiro Dlist para lista encadeada.
+ * @return InfoDlist* pointer do elemento removido, ou NULL caso falhe.
+ */
+InfoDlist *dellastdlst(Dlist *lst) {
+    if (isemptydlst(lst)) return NULL;
+    return lst->reversed ? popfrontdlst(lst) : popbackdlst(lst);
+}
+
 /**
  * Insere nó em uma posição da lista.
  * 
+ * O nó passa a ocupar a posição pos, deslocando o elemento que
+ * estava nela. Posições menores que 1 inserem no início e maiores
+ * que o tamanho da lista inserem no final. A busca parte da
+ * extremidade mais próxima.
+ * 
  * @param lst ponteiro Dlist da lista encadeada.
  * @param info ponteiro InfoDlist com informação a ser gravada em nó.
  * @param pos posição para inserir o nó.
@@ -136,31 +317,22 @@ InfoDlist *delfirstdlst(Dlist *lst) {
  */
 int insertposdlst(Dlist *lst, InfoDlist *info, int pos) {
     NodeDlist *ptr, *aux;
-    aux = dlstnode();
-    int i;
 
-    if (!lst || !ptr) return 0;
-    
+    if (!lst) return 0;
+    if (pos <= 1) return insertfirstdlst(lst, info);
+    if (pos > lst->size) return insertlastdlst(lst, info);
+
+    aux = dlstnode();
+    if (!aux) return 0;
     aux->info = info;
 
-    if (lst->first == NULL) lst->first = aux;
-    else {
-        ptr = lst->first;
-        for (i = 1; i < pos && ptr->next != NULL; i++, ptr = ptr->next);
-        if (i < pos) {
-            ptr->next = aux;
-            aux->prev = ptr;
-        }
-        else {
-            if (ptr->prev != NULL) {
-                ptr->prev->next = aux;
-                aux->prev = ptr->prev;
-            }
-            else lst->first = aux;
-            aux->next = ptr;
-            ptr->prev = aux;
-        }
-    }
+    // Nó que ficará logo depois do novo, em ordem física.
+    ptr = nodeposdlst(lst, lst->reversed ? lst->size + 2 - pos : pos);
+    ptr->prev->next = aux;
+    aux->prev = ptr->prev;
+    aux->next = ptr;
+    ptr->prev = aux;
+
     lst->size++;
     return 1;
 }
@@ -168,6 +340,8 @@ int insertposdlst(Dlist *lst, InfoDlist *info, int pos) {
 /**
  * Remove elemento em uma posição da lista.
  * 
+ * A busca parte da extremidade mais próxima de pos.
+ * 
  * @param lst ponteiro Dlist da lista encadeada.
  * @param pos inteiro com posição a ser removida.
  * @return InfoDlist* do elemento removido, ou NULL caso falhe.
@@ -175,22 +349,35 @@ int insertposdlst(Dlist *lst, InfoDlist *info, int pos) {
 InfoDlist *delposdlst(Dlist *lst, int pos) {
     NodeDlist *ptr;
     InfoDlist *info;
-    int i;
 
     if (isemptydlst(lst) || pos > lst->size || pos <= 0) return NULL;
 
-    ptr = lst->first;
-    for (i = 1; i < pos; i++, ptr = ptr->next);
+    ptr = nodeposdlst(lst, lst->reversed ? lst->size + 1 - pos : pos);
     if (ptr->prev != NULL) ptr->prev->next = ptr->next;
     else lst->first = ptr->next;
     if (ptr->next != NULL) ptr->next->prev = ptr->prev;
+    else lst->last = ptr->prev;
     info = ptr->info;
 
-    free(ptr);
+    freenodedlst(ptr);
     lst->size--;
     return info;
 }
 
+/**
+ * Consulta elemento em uma posição da lista.
+ * 
+ * A busca parte da extremidade mais próxima de pos.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @param pos inteiro com posição a ser consultada.
+ * @return InfoDlist* do elemento na posição, ou NULL caso não exista.
+ */
+InfoDlist *getposdlst(Dlist *lst, int pos) {
+    if (isemptydlst(lst) || pos > lst->size || pos <= 0) return NULL;
+    return nodeposdlst(lst, lst->reversed ? lst->size + 1 - pos : pos)->info;
+}
+
 /**
  * Destroi lista.
  * 
@@ -205,7 +392,7 @@ void destroydlst(Dlist *lst) {
     while (lst->first) {
         ptr = lst->first->next;
         free(lst->first->info);
-        free(lst->first);
+        freenodedlst(lst->first);
         lst->first = ptr;
     }
     free(lst);
@@ -214,22 +401,93 @@ void destroydlst(Dlist *lst) {
 /**
  * Inverte a lista encadeada.
  * 
+ * Executa em tempo constante: apenas troca o sentido lógico da
+ * lista, sem religar nós. Todas as operações respeitam o sentido.
+ * 
  * @param lst ponteiro Dlist da lista encadeada.
  */
 void reversedlst(Dlist *lst) {
-    NodeDlist *prev = NULL, *current, *next;
+    if (!lst) return;
+    lst->reversed = !lst->reversed;
+}
 
-    if (isemptydlst(lst) || lst->size == 1) return;
+/**
+ * Intercala duas cadeias ordenadas pelos ponteiros next.
+ * 
+ * Em empates o nó de a vem primeiro, o que torna a ordenação estável.
+ * 
+ * @param a ponteiro NodeDlist da primeira cadeia.
+ * @param b ponteiro NodeDlist da segunda cadeia.
+ * @return NodeDlist* pointer para o início da cadeia intercalada.
+ */
+static NodeDlist *mergechaindlst(NodeDlist *a, NodeDlist *b) {
+    NodeDlist head, *tail = &head;
+
+    while (a && b) {
+        if (b->info->value < a->info->value) {
+            tail->next = b;
+            b = b->next;
+        }
+        else {
+            tail->next = a;
+            a = a->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = a ? a : b;
+    return head.next;
+}
 
-    current = lst->first;
-    while(current != NULL) {
-        next = current->next;
-        current->next = prev;
-        current->prev = next;
-        prev = current;
-        current = next;
+/**
+ * Ordena os n primeiros nós de uma lista a partir de um nó.
+ * 
+ * Os nós ainda não visitados são percorridos na ordem lógica; os
+ * já ordenados ficam ligados apenas por next, e prev é refeito
+ * por quem chama.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @param head ponteiro para o nó inicial; avança para o nó
+ *             seguinte aos n ordenados.
+ * @param n quantidade de nós a ordenar (maior que zero).
+ * @return NodeDlist* pointer para a cadeia ordenada, terminada em NULL.
+ */
+static NodeDlist *sortchaindlst(Dlist *lst, NodeDlist **head, int n) {
+    NodeDlist *a, *b;
+
+    if (n == 1) {
+        a = *head;
+        *head = NEXTDLST(lst, a);
+        a->next = NULL;
+        return a;
     }
-    lst->first = prev;
+    a = sortchaindlst(lst, head, n / 2);
+    b = sortchaindlst(lst, head, n - n / 2);
+    return mergechaindlst(a, b);
+}
+
+/**
+ * Ordena lista com merge sort.
+ * 
+ * Ordenação estável em O(n log n), segundo a ordem lógica, que
+ * religa os nós em vez de trocar informações. Ao final a ordem
+ * física coincide com a lógica (reversed volta a zero).
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ */
+void mergesortdlst(Dlist *lst) {
+    NodeDlist *ptr, *prev = NULL;
+
+    if (!lst) return;
+    if (lst->size < 2) {
+        lst->reversed = 0;
+        return;
+    }
+
+    ptr = FIRSTDLST(lst);
+    lst->first = sortchaindlst(lst, &ptr, lst->size);
+    for (ptr = lst->first; ptr; prev = ptr, ptr = ptr->next) ptr->prev = prev;
+    lst->last = prev;
+    lst->reversed = 0;
 }
 
 /**
@@ -246,11 +504,11 @@ void printdlst(Dlist *lst) {
     if (isemptydlst(lst)) return;
 
     printf("\n[ ");
-    ptr = lst->first;
+    ptr = FIRSTDLST(lst);
 
     while (ptr != NULL) {
         printf("(%d) ", ptr->info->value);
-        ptr = ptr->next;
+        ptr = NEXTDLST(lst, ptr);
     }
     printf("]\n");
 }
@@ -286,12 +544,36 @@ InfoDlist *finddlst(Dlist *lst, InfoDlist *info) {
 
     if (isemptydlst(lst)) return NULL;
     
-    for (ptr = lst->first; ptr; ptr = ptr->next) {
+    for (ptr = FIRSTDLST(lst); ptr; ptr = NEXTDLST(lst, ptr)) {
         if (ptr->info->value == info->value) return ptr->info;
     }
     return NULL;
 }
 
+/**
+ * Encontra informação na lista encadeada com prefetch.
+ * 
+ * Mesmo resultado de finddlst, pedindo ao processador a informação
+ * de cada nó dist nós antes da comparação. Os nós continuam sendo
+ * lidos um a um; ver linkedlist/pfscan.h.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @param info ponteiro InfoDlist com informação a ser buscada.
+ * @param dist distância de prefetch em nós, ou <= 0 para PFSCAN_DIST.
+ * @return InfoDlist* pointer contendo nó encontrado, ou NULL caso não exista.
+ */
+InfoDlist *findpfdlst(Dlist *lst, InfoDlist *info, int dist) {
+    if (isemptydlst(lst)) return NULL;
+
+// Segue o sentido lógico da lista.
+#define NEXTPFDLST(node) NEXTDLST(lst, node)
+    PFSCAN(NodeDlist, ptr, FIRSTDLST(lst), NEXTPFDLST, dist,
+        if (ptr->info->value == info->value) return ptr->info;
+    );
+#undef NEXTPFDLST
+    return NULL;
+}
+
 /**
  * Verifica presença de informação na lista.
  * 
@@ -306,10 +588,81 @@ int isindlst(Dlist *lst, InfoDlist *info) {
     NodeDlist *ptr;
 
     if (isemptydlst(lst)) return 0;
-    ptr = lst->first;
+    ptr = FIRSTDLST(lst);
     while (ptr != NULL) {
         if (ptr->info->value == info->value) return 1;
-        ptr = ptr->next;
+        ptr = NEXTDLST(lst, ptr);
     }
     return 0;
+}
+
+/**
+ * Verifica presença de informação na lista encadeada com prefetch.
+ * 
+ * Mesmo resultado de isindlst, usando o percurso
+ * antecipado de findpfdlst.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @param info ponteiro InfoDlist com informação a ser buscada.
+ * @param dist distância de prefetch em nós, ou <= 0 para PFSCAN_DIST.
+ * @return int 1 caso exista na lista encadeada, 0 caso contrário.
+ */
+int isinpfdlst(Dlist *lst, InfoDlist *info, int dist) {
+    return findpfdlst(lst, info, dist) != NULL;
+}
+
+/**
+ * Remove elementos que satisfazem um predicado.
+ * 
+ * Percorre a lista uma única vez desligando todos os elementos
+ * para os quais pred retorna diferente de zero. Os elementos
+ * removidos são gravados em out, na ordem da lista, ou liberados
+ * caso out seja NULL.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @param pred função que recebe a informação e arg.
+ * @param arg ponteiro repassado a pred.
+ * @param out vetor com espaço para lendlst(lst) ponteiros, ou NULL.
+ * @return int quantidade de elementos removidos, -1 caso falhe.
+ */
+int removeifdlst(Dlist *lst, int (*pred)(InfoDlist *, void *), void *arg, InfoDlist **out) {
+    int count;
+
+    if (!lst || !pred) return -1;
+
+    REMOVEIFDLST(lst, info, pred(info, arg), out, count);
+    return count;
+}
+
+/**
+ * Reorganiza nós da lista em memória contígua.
+ * 
+ * Realoca todos os nós em um único bloco, na ordem de percurso,
+ * refazendo os ponteiros next e prev, e libera os nós antigos,
+ * liberando também blocos antigos mantidos por poucos nós. A
+ * ordem física passa a coincidir com a lógica (reversed volta a
+ * zero). As informações não são movidas: ponteiros InfoDlist
+ * obtidos antes da chamada continuam válidos.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int relayoutdlst(Dlist *lst) {
+    NodeDlist *old, *next, *ptr;
+
+    if (!lst) return 0;
+    if (lst->size == 0) return 1;
+
+    ptr = blockdlst(lst->size);
+    if (!ptr) return 0;
+
+    old = FIRSTDLST(lst);
+    for (lst->first = ptr; old; old = next, ptr = ptr->next) {
+        next = NEXTDLST(lst, old);
+        ptr->info = old->info;
+        lst->last = ptr;
+        freenodedlst(old);
+    }
+    lst->reversed = 0;
+    return 1;
 }
\ No newline at end of file
@@ -9,6 +9,8 @@
 #ifndef DLINKEDLIST_H
 #define DLINKEDLIST_H
 
+#include <stdlib.h>
+
 /**
  * Estruturas de dados
  */
@@ -20,13 +22,70 @@ typedef struct {
 typedef struct tnode {
     struct tnode *next, *prev;
     InfoDlist *info;
+    struct tblock *block;
 } NodeDlist;
 
+typedef struct tblock {
+    NodeDlist *nodes;
+    int capacity, live;
+} BlockDlist;
+
 typedef struct {
     int size;
-    NodeDlist *first;
+    NodeDlist *first, *last;
+    int reversed;
 } Dlist;
 
+/**
+ * Percurso em ordem lógica.
+ * 
+ * first, last, next e prev são ligações físicas. Com reversed
+ * diferente de zero a lista é lida de last para first, de forma
+ * que reversedlst executa em tempo constante. Percursos feitos
+ * fora deste módulo devem usar estas macros.
+ */
+#define FIRSTDLST(lst) ((lst)->reversed ? (lst)->last : (lst)->first)
+#define LASTDLST(lst) ((lst)->reversed ? (lst)->first : (lst)->last)
+#define NEXTDLST(lst, node) ((lst)->reversed ? (node)->prev : (node)->next)
+#define PREVDLST(lst, node) ((lst)->reversed ? (node)->next : (node)->prev)
+
+/**
+ * Remove, em uma única passada, todos os elementos que
+ * satisfazem uma condição.
+ * 
+ * Versão em macro de removeifdlst para laços críticos: a condição
+ * é expandida no próprio laço, sem chamada indireta. Dentro de
+ * cond, var é o InfoDlist* do elemento corrente. lst é avaliada
+ * várias vezes e deve ser uma lista válida.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @param var nome da variável InfoDlist* usada em cond.
+ * @param cond expressão que decide se o elemento é removido.
+ * @param out vetor InfoDlist** que recebe os removidos, ou NULL
+ *            para liberá-los.
+ * @param count variável int que recebe a quantidade removida.
+ */
+#define REMOVEIFDLST(lst, var, cond, out, count) do {               \
+    NodeDlist *rmptr_, *rmnext_;                                    \
+    InfoDlist **rmout_ = (out);                                     \
+    (count) = 0;                                                    \
+    for (rmptr_ = FIRSTDLST(lst); rmptr_; rmptr_ = rmnext_) {       \
+        InfoDlist *var = rmptr_->info;                              \
+        rmnext_ = NEXTDLST((lst), rmptr_);                          \
+        if (cond) {                                                 \
+            if (rmptr_->prev) rmptr_->prev->next = rmptr_->next;    \
+            else (lst)->first = rmptr_->next;                       \
+            if (rmptr_->next) rmptr_->next->prev = rmptr_->prev;    \
+            else (lst)->last = rmptr_->prev;                        \
+            if (rmout_) rmout_[(count)] = var;                      \
+            else free(var);                                         \
+            freenodedlst(rmptr_);                                   \
+            (count)++;                                              \
+        }                                                           \
+    }                                                               \
+    (lst)->size -= (count);                                         \
+} while (0)
+
 /**
  * Cria cabeça de lista.
  * 
@@ -67,6 +126,17 @@ NodeDlist *dlstnode();
  */
 InfoDlist *dlstinfo(int i);
 
+/**
+ * Libera nó.
+ * 
+ * Substitui free para nós da lista. Um nó de bloco só devolve a
+ * memória quando o último nó vivo do bloco é liberado, o que
+ * permite a relayoutdlst mover nós sem copiar informações.
+ * 
+ * @param node ponteiro NodeDlist já desligado da lista.
+ */
+void freenodedlst(NodeDlist *node);
+
 /**
  * Insere nó no inicio da lista.
  * 
@@ -84,9 +154,31 @@ int insertfirstdlst(Dlist *lst, InfoDlist *info);
  */
 InfoDlist *delfirstdlst(Dlist *lst);
 
+/**
+ * Insere nó no final da lista.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @param info ponteiro InfoDlist com informação a ser gravada em nó.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertlastdlst(Dlist *lst, InfoDlist *info);
+
+/**
+ * Remove último elemento da lista.
+ * 
+ * @param lst ponteiro Dlist para lista encadeada.
+ * @return InfoDlist* pointer do elemento removido, ou NULL caso falhe.
+ */
+InfoDlist *dellastdlst(Dlist *lst);
+
 /**
  * Insere nó em uma posição da lista.
  * 
+ * O nó passa a ocupar a posição pos, deslocando o elemento que
+ * estava nela. Posições menores que 1 inserem no início e maiores
+ * que o tamanho da lista inserem no final. A busca parte da
+ * extremidade mais próxima.
+ * 
  * @param lst ponteiro Dlist da lista encadeada.
  * @param info ponteiro InfoDlist com informação a ser gravada em nó.
  * @param pos posição para inserir o nó.
@@ -97,12 +189,25 @@ int insertposdlst(Dlist *lst, InfoDlist *info, int pos);
 /**
  * Remove elemento em uma posição da lista.
  * 
+ * A busca parte da extremidade mais próxima de pos.
+ * 
  * @param lst ponteiro Dlist da lista encadeada.
  * @param pos inteiro com posição a ser removida.
  * @return InfoDlist* do elemento removido, ou NULL caso falhe.
  */
 InfoDlist *delposdlst(Dlist *lst, int pos);
 
+/**
+ * Consulta elemento em uma posição da lista.
+ * 
+ * A busca parte da extremidade mais próxima de pos.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @param pos inteiro com posição a ser consultada.
+ * @return InfoDlist* do elemento na posição, ou NULL caso não exista.
+ */
+InfoDlist *getposdlst(Dlist *lst, int pos);
+
 /**
  * Destroi lista.
  * 
@@ -116,10 +221,24 @@ void destroydlst(Dlist *lst);
 /**
  * Inverte a lista encadeada.
  * 
+ * Executa em tempo constante: apenas troca o sentido lógico da
+ * lista, sem religar nós. Todas as operações respeitam o sentido.
+ * 
  * @param lst ponteiro Dlist da lista encadeada.
  */
 void reversedlst(Dlist *lst);
 
+/**
+ * Ordena lista com merge sort.
+ * 
+ * Ordenação estável em O(n log n), segundo a ordem lógica, que
+ * religa os nós em vez de trocar informações. Ao final a ordem
+ * física coincide com a lógica (reversed volta a zero).
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ */
+void mergesortdlst(Dlist *lst);
+
 /**
  * Imprime elementos de lista.
  * 
@@ -155,6 +274,20 @@ int lendlst(Dlist *lst);
  */
 InfoDlist *finddlst(Dlist *lst, InfoDlist *info);
 
+/**
+ * Encontra informação na lista encadeada com prefetch.
+ * 
+ * Mesmo resultado de finddlst, pedindo ao processador a informação
+ * de cada nó dist nós antes da comparação. Os nós continuam sendo
+ * lidos um a um; ver linkedlist/pfscan.h.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @param info ponteiro InfoDlist com informação a ser buscada.
+ * @param dist distância de prefetch em nós, ou <= 0 para PFSCAN_DIST.
+ * @return InfoDlist* pointer contendo nó encontrado, ou NULL caso não exista.
+ */
+InfoDlist *findpfdlst(Dlist *lst, InfoDlist *info, int dist);
+
 /**
  * Verifica presença de informação na lista.
  * 
@@ -167,4 +300,48 @@ InfoDlist *finddlst(Dlist *lst, InfoDlist *info);
  */
 int isindlst(Dlist *lst, InfoDlist *info);
 
+/**
+ * Verifica presença de informação na lista encadeada com prefetch.
+ * 
+ * Mesmo resultado de isindlst, usando o percurso
+ * antecipado de findpfdlst.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @param info ponteiro InfoDlist com informação a ser buscada.
+ * @param dist distância de prefetch em nós, ou <= 0 para PFSCAN_DIST.
+ * @return int 1 caso exista na lista encadeada, 0 caso contrário.
+ */
+int isinpfdlst(Dlist *lst, InfoDlist *info, int dist);
+
+/**
+ * Remove elementos que satisfazem um predicado.
+ * 
+ * Percorre a lista uma única vez desligando todos os elementos
+ * para os quais pred retorna diferente de zero. Os elementos
+ * removidos são gravados em out, na ordem da lista, ou liberados
+ * caso out seja NULL.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @param pred função que recebe a informação e arg.
+ * @param arg ponteiro repassado a pred.
+ * @param out vetor com espaço para lendlst(lst) ponteiros, ou NULL.
+ * @return int quantidade de elementos removidos, -1 caso falhe.
+ */
+int removeifdlst(Dlist *lst, int (*pred)(InfoDlist *, void *), void *arg, InfoDlist **out);
+
+/**
+ * Reorganiza nós da lista em memória contígua.
+ * 
+ * Realoca todos os nós em um único bloco, na ordem de percurso,
+ * refazendo os ponteiros next e prev, e libera os nós antigos,
+ * liberando também blocos antigos mantidos por poucos nós. A
+ * ordem física passa a coincidir com a lógica (reversed volta a
+ * zero). As informações não são movidas: ponteiros InfoDlist
+ * obtidos antes da chamada continuam válidos.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int relayoutdlst(Dlist *lst);
+
 #endif
\ No newline at end of file
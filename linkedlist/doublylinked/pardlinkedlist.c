@@ -0,0 +1,294 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdlib.h>
+#include "pardlinkedlist.h"
+#include "../../sorting/gensort.h"
+#include "../../sorting/genparallelsort.h"
+
+/**
+ * Tarefa de um segmento.
+ */
+typedef struct {
+    Dlist *lst;
+    NodeDlist *start;
+    int count;
+    void (*fn)(InfoDlist *, void *);
+    long long (*map)(InfoDlist *, void *);
+    long long (*combine)(long long, long long);
+    long long result;
+    void *arg;
+} JobParDlist;
+
+/**
+ * Executa tarefa de segmento.
+ * 
+ * @param arg ponteiro JobParDlist da tarefa.
+ */
+static void runjobpardlst(void *arg) {
+    JobParDlist *job = (JobParDlist *) arg;
+    NodeDlist *ptr = job->start;
+    long long acc = job->result;
+    int i;
+
+    if (job->fn) {
+        for (i = 0; i < job->count; i++, ptr = NEXTDLST(job->lst, ptr)) job->fn(ptr->info, job->arg);
+        return;
+    }
+    for (i = 0; i < job->count; i++, ptr = NEXTDLST(job->lst, ptr)) acc = job->combine(acc, job->map(ptr->info, job->arg));
+    job->result = acc;
+}
+
+/**
+ * Executa uma tarefa por segmento.
+ * 
+ * @param pool ponteiro ThreadPool que executa as tarefas, ou NULL.
+ * @param split ponteiro SplitDlist com os segmentos da lista.
+ * @param jobs vetor com uma tarefa por segmento.
+ */
+static void runjobspardlst(ThreadPool *pool, SplitDlist *split, JobParDlist *jobs) {
+    int i;
+
+    for (i = 0; i < split->nseg; i++) {
+        jobs[i].lst = split->lst;
+        jobs[i].start = split->starts[i];
+        jobs[i].count = split->counts[i];
+        if (!pool || !submitpool(pool, runjobpardlst, &jobs[i])) runjobpardlst(&jobs[i]);
+    }
+    waitpool(pool);
+}
+
+/**
+ * Divide lista em segmentos.
+ * 
+ * Percorre a lista uma vez guardando o primeiro nó e o tamanho de
+ * cada segmento. Listas menores que nseg geram um segmento por nó.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @param nseg quantidade de segmentos desejada (maior que zero).
+ * @return SplitDlist* pointer para divisão criada, ou NULL caso falhe.
+ */
+SplitDlist *createsplitdlst(Dlist *lst, int nseg) {
+    SplitDlist *split;
+    NodeDlist *ptr;
+    int i, j;
+
+    if (!lst || nseg <= 0) return NULL;
+    if (nseg > lst->size) nseg = lst->size;
+
+    split = (SplitDlist *) malloc(sizeof(SplitDlist));
+    if (!split) return NULL;
+    split->starts = (NodeDlist **) malloc((nseg + 1) * sizeof(NodeDlist *));
+    split->counts = (int *) malloc((nseg + 1) * sizeof(int));
+    if (!split->starts || !split->counts) {
+        destroysplitdlst(split);
+        return NULL;
+    }
+    split->lst = lst;
+    split->nseg = nseg;
+
+    ptr = FIRSTDLST(lst);
+    for (i = 0; i < nseg; i++) {
+        split->starts[i] = ptr;
+        split->counts[i] = lst->size / nseg + (i < lst->size % nseg);
+        for (j = 0; j < split->counts[i]; j++) ptr = NEXTDLST(lst, ptr);
+    }
+    return split;
+}
+
+/**
+ * Destroi divisão de lista.
+ * 
+ * @param split ponteiro SplitDlist a ser liberado.
+ */
+void destroysplitdlst(SplitDlist *split) {
+    if (!split) return;
+    free(split->starts);
+    free(split->counts);
+    free(split);
+}
+
+/**
+ * Aplica função a todos os elementos em paralelo.
+ * 
+ * Cada segmento é processado por uma tarefa do pool. fn pode
+ * alterar a informação recebida, mas não a estrutura da lista.
+ * Com pool NULL os segmentos são processados na thread chamadora.
+ * 
+ * @param pool ponteiro ThreadPool que executa as tarefas, ou NULL.
+ * @param split ponteiro SplitDlist com os segmentos da lista.
+ * @param fn função que recebe a informação e arg.
+ * @param arg ponteiro repassado a fn.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int foreachpardlst(ThreadPool *pool, SplitDlist *split, void (*fn)(InfoDlist *, void *), void *arg) {
+    JobParDlist *jobs;
+    int i;
+
+    if (!split || !fn) return 0;
+    if (split->nseg == 0) return 1;
+
+    jobs = (JobParDlist *) malloc(split->nseg * sizeof(JobParDlist));
+    if (!jobs) return 0;
+
+    for (i = 0; i < split->nseg; i++) {
+        jobs[i].fn = fn;
+        jobs[i].arg = arg;
+    }
+    runjobspardlst(pool, split, jobs);
+
+    free(jobs);
+    return 1;
+}
+
+/**
+ * Reduz elementos da lista em paralelo.
+ * 
+ * Cada segmento calcula combine(...combine(identity, map(x1))...,
+ * map(xk)) e os resultados parciais são combinados na ordem dos
+ * segmentos. combine deve ser associativa e identity seu elemento
+ * neutro. Soma, contagem por predicado, mínimo e máximo são casos
+ * particulares.
+ * 
+ * @param pool ponteiro ThreadPool que executa as tarefas, ou NULL.
+ * @param split ponteiro SplitDlist com os segmentos da lista.
+ * @param map função que recebe a informação e arg.
+ * @param combine função associativa que combina dois resultados.
+ * @param identity elemento neutro de combine.
+ * @param arg ponteiro repassado a map.
+ * @return long long resultado da redução, identity para lista vazia.
+ */
+long long reducepardlst(ThreadPool *pool, SplitDlist *split, long long (*map)(InfoDlist *, void *),
+                        long long (*combine)(long long, long long), long long identity, void *arg) {
+    JobParDlist *jobs;
+    long long acc = identity;
+    int i;
+
+    if (!split || !map || !combine || split->nseg == 0) return identity;
+
+    jobs = (JobParDlist *) malloc(split->nseg * sizeof(JobParDlist));
+    if (!jobs) return identity;
+
+    for (i = 0; i < split->nseg; i++) {
+        jobs[i].fn = NULL;
+        jobs[i].map = map;
+        jobs[i].combine = combine;
+        jobs[i].result = identity;
+        jobs[i].arg = arg;
+    }
+    runjobspardlst(pool, split, jobs);
+
+    for (i = 0; i < split->nseg; i++) acc = combine(acc, jobs[i].result);
+    free(jobs);
+    return acc;
+}
+
+/**
+ * Chave de ordenação: valor e nó de origem.
+ */
+typedef struct {
+    int value;
+    NodeDlist *node;
+} KeyParDlist;
+
+#define LESSKEYPARDLST(a, b) ((a).value < (b).value)
+
+// Trechos estáveis, intercalados em paralelo: a ordenação inteira é estável.
+DEFINESTABLESORTTMP(runkeyspardlst, KeyParDlist, LESSKEYPARDLST)
+DEFINEPARALLELSORT(sortkeyspardlst, KeyParDlist, LESSKEYPARDLST, runkeyspardlst)
+
+/**
+ * Tarefa de religação: trecho [from, to) do vetor de chaves.
+ */
+typedef struct {
+    KeyParDlist *keys;
+    int from, to, n;
+} JobLinkParDlist;
+
+/**
+ * Tarefa: religa next e prev dos nós do trecho [from, to).
+ */
+static void runlinkpardlst(void *arg) {
+    JobLinkParDlist *job = (JobLinkParDlist *) arg;
+    KeyParDlist *keys = job->keys;
+    int i;
+
+    for (i = job->from; i < job->to; i++) {
+        keys[i].node->next = i + 1 < job->n ? keys[i + 1].node : NULL;
+        keys[i].node->prev = i > 0 ? keys[i - 1].node : NULL;
+    }
+}
+
+/**
+ * Ordena lista em paralelo.
+ * 
+ * Copia valores e nós para um vetor em uma passada, ordena o
+ * vetor com o merge sort paralelo de genparallelsort.h e religa
+ * os nós em paralelo, refazendo next e prev. A ordenação é
+ * estável, segue a ordem lógica e dá o mesmo resultado de
+ * mergesortdlst (reversed volta a zero). Com pool NULL tudo é
+ * feito na thread chamadora.
+ * 
+ * @param pool ponteiro ThreadPool que executa as tarefas, ou NULL.
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @return int 1 para sucesso, 0 caso contrário (lista inalterada).
+ */
+int sortpardlst(ThreadPool *pool, Dlist *lst) {
+    KeyParDlist *keys, *tmp;
+    JobLinkParDlist *jobs;
+    NodeDlist *ptr;
+    int i, n, nthreads;
+
+    if (!lst) return 0;
+    if (lst->size < 2) {
+        lst->reversed = 0;
+        return 1;
+    }
+
+    n = lst->size;
+    nthreads = pool ? lenpool(pool) : 1;
+    if (nthreads > n) nthreads = n;
+
+    keys = (KeyParDlist *) malloc(n * sizeof(KeyParDlist));
+    tmp = (KeyParDlist *) malloc(n * sizeof(KeyParDlist));
+    jobs = (JobLinkParDlist *) malloc(nthreads * sizeof(JobLinkParDlist));
+    if (!keys || !tmp || !jobs) {
+        free(keys);
+        free(tmp);
+        free(jobs);
+        return 0;
+    }
+
+    for (i = 0, ptr = FIRSTDLST(lst); i < n; i++, ptr = NEXTDLST(lst, ptr)) {
+        keys[i].value = ptr->info->value;
+        keys[i].node = ptr;
+    }
+    if (!sortkeyspardlst(pool, keys, tmp, n)) {
+        free(keys);
+        free(tmp);
+        free(jobs);
+        return 0;
+    }
+
+    for (i = 0; i < nthreads; i++) {
+        jobs[i].keys = keys;
+        jobs[i].n = n;
+        jobs[i].from = (int) ((long long) n * i / nthreads);
+        jobs[i].to = (int) ((long long) n * (i + 1) / nthreads);
+        if (!pool || !submitpool(pool, runlinkpardlst, &jobs[i])) runlinkpardlst(&jobs[i]);
+    }
+    waitpool(pool);
+    lst->first = keys[0].node;
+    lst->last = keys[n - 1].node;
+    lst->reversed = 0;
+
+    free(keys);
+    free(tmp);
+    free(jobs);
+    return 1;
+}
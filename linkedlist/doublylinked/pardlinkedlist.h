@@ -0,0 +1,111 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef PARDLINKEDLIST_H
+#define PARDLINKEDLIST_H
+
+#include "dlinkedlist.h"
+#include "../../threadpool/threadpool.h"
+
+/**
+ * Tarefas no pool.
+ * 
+ * foreachpardlst, reducepardlst e sortpardlst aguardam suas
+ * tarefas com waitpool, que espera por todas as tarefas do pool.
+ * Chamá-las de dentro de uma tarefa do mesmo pool trava: waitpool
+ * espera também pela tarefa chamadora, que nunca termina.
+ */
+
+/**
+ * Estruturas de dados
+ * 
+ * Pontos de divisão de uma lista em segmentos consecutivos de
+ * tamanhos aproximadamente iguais. Calculados em uma passada e
+ * reaproveitáveis enquanto a lista não tiver nós inseridos ou
+ * removidos, nem for invertida. Os segmentos seguem a ordem
+ * lógica da lista.
+ */
+
+typedef struct {
+    Dlist *lst;
+    NodeDlist **starts;
+    int *counts;
+    int nseg;
+} SplitDlist;
+
+/**
+ * Divide lista em segmentos.
+ * 
+ * Percorre a lista uma vez guardando o primeiro nó e o tamanho de
+ * cada segmento. Listas menores que nseg geram um segmento por nó.
+ * 
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @param nseg quantidade de segmentos desejada (maior que zero).
+ * @return SplitDlist* pointer para divisão criada, ou NULL caso falhe.
+ */
+SplitDlist *createsplitdlst(Dlist *lst, int nseg);
+
+/**
+ * Destroi divisão de lista.
+ * 
+ * @param split ponteiro SplitDlist a ser liberado.
+ */
+void destroysplitdlst(SplitDlist *split);
+
+/**
+ * Aplica função a todos os elementos em paralelo.
+ * 
+ * Cada segmento é processado por uma tarefa do pool. fn pode
+ * alterar a informação recebida, mas não a estrutura da lista.
+ * Com pool NULL os segmentos são processados na thread chamadora.
+ * 
+ * @param pool ponteiro ThreadPool que executa as tarefas, ou NULL.
+ * @param split ponteiro SplitDlist com os segmentos da lista.
+ * @param fn função que recebe a informação e arg.
+ * @param arg ponteiro repassado a fn.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int foreachpardlst(ThreadPool *pool, SplitDlist *split, void (*fn)(InfoDlist *, void *), void *arg);
+
+/**
+ * Reduz elementos da lista em paralelo.
+ * 
+ * Cada segmento calcula combine(...combine(identity, map(x1))...,
+ * map(xk)) e os resultados parciais são combinados na ordem dos
+ * segmentos. combine deve ser associativa e identity seu elemento
+ * neutro. Soma, contagem por predicado, mínimo e máximo são casos
+ * particulares.
+ * 
+ * @param pool ponteiro ThreadPool que executa as tarefas, ou NULL.
+ * @param split ponteiro SplitDlist com os segmentos da lista.
+ * @param map função que recebe a informação e arg.
+ * @param combine função associativa que combina dois resultados.
+ * @param identity elemento neutro de combine.
+ * @param arg ponteiro repassado a map.
+ * @return long long resultado da redução, identity para lista vazia.
+ */
+long long reducepardlst(ThreadPool *pool, SplitDlist *split, long long (*map)(InfoDlist *, void *),
+                        long long (*combine)(long long, long long), long long identity, void *arg);
+
+/**
+ * Ordena lista em paralelo.
+ * 
+ * Copia valores e nós para um vetor em uma passada, ordena o
+ * vetor com o merge sort paralelo de genparallelsort.h e religa
+ * os nós em paralelo, refazendo next e prev. A ordenação é
+ * estável, segue a ordem lógica e dá o mesmo resultado de
+ * mergesortdlst (reversed volta a zero). Com pool NULL tudo é
+ * feito na thread chamadora.
+ * 
+ * @param pool ponteiro ThreadPool que executa as tarefas, ou NULL.
+ * @param lst ponteiro Dlist da lista encadeada.
+ * @return int 1 para sucesso, 0 caso contrário (lista inalterada).
+ */
+int sortpardlst(ThreadPool *pool, Dlist *lst);
+
+#endif
@@ -9,6 +9,11 @@
 #include <stdio.h>
 #include "dlinkedlist.h"
 
+int isodd(InfoDlist *info, void *arg) {
+    (void) arg;
+    return info->value % 2;
+}
+
 // dummy test
 int main() {
     Dlist *lst = createdlst();
@@ -33,5 +38,52 @@ int main() {
     delfirstdlst(lst);
     printdlst(lst);
 
+    // Remove elementos ímpares com predicado.
+    // Output: [ (22) ]
+    removeifdlst(lst, isodd, NULL, NULL);
+    printdlst(lst);
+
+    // Reorganiza nós em um bloco contíguo e remove o do meio.
+    // Output: [ (25) (23) (22) ] e [ (25) (22) ]
+    insertfirstdlst(lst, dlstinfo(23));
+    insertfirstdlst(lst, dlstinfo(25));
+    relayoutdlst(lst);
+    printdlst(lst);
+    free(delposdlst(lst, 2));
+    printdlst(lst);
+
+    // Busca com prefetch na distância padrão.
+    // Output: 1 0
+    InfoDlist key = { 22 }, absent = { 23 };
+    printf("%d %d\n", isinpfdlst(lst, &key, 0), isinpfdlst(lst, &absent, 0));
+
+    // Usa a lista como deque: insere nas duas pontas e no meio.
+    // Output: [ (20) (25) (30) (22) (40) ] e 30 na posição 3
+    insertfirstdlst(lst, dlstinfo(20));
+    insertlastdlst(lst, dlstinfo(40));
+    insertposdlst(lst, dlstinfo(30), 3);
+    printdlst(lst);
+    printf("%d na posição 3\n", getposdlst(lst, 3)->value);
+
+    // Remove das duas pontas.
+    // Output: [ (25) (30) (22) ]
+    free(delfirstdlst(lst));
+    free(dellastdlst(lst));
+    printdlst(lst);
+
+    // Inverte em tempo constante; as pontas trocam de papel.
+    // Output: [ (22) (30) (25) (10) ] e 30 na posição 2
+    reversedlst(lst);
+    insertlastdlst(lst, dlstinfo(10));
+    printdlst(lst);
+    printf("%d na posição 2\n", getposdlst(lst, 2)->value);
+
+    // Ordena religando nós; a lista volta ao sentido físico.
+    // Output: [ (10) (22) (25) (30) ] e 30 na última posição
+    mergesortdlst(lst);
+    printdlst(lst);
+    printf("%d na última posição\n", getposdlst(lst, lendlst(lst))->value);
+
+    destroydlst(lst);
     return 0;
 }
\ No newline at end of file
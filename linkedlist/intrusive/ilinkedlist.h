@@ -0,0 +1,202 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef ILINKEDLIST_H
+#define ILINKEDLIST_H
+
+#include <stddef.h>
+
+/**
+ * Estruturas de dados
+ *
+ * Lista duplamente encadeada intrusiva: os ponteiros next e prev
+ * ficam em um LinkIlist embutido na estrutura do chamador, e a
+ * lista é circular em torno de um LinkIlist sentinela (a cabeça).
+ * Nenhuma operação aloca memória, e um mesmo objeto pode estar em
+ * várias listas ao mesmo tempo, um LinkIlist por lista.
+ *
+ *     typedef struct {
+ *         int value;
+ *         LinkIlist byage, byname;
+ *     } Person;
+ */
+
+typedef struct tlink {
+    struct tlink *next, *prev;
+} LinkIlist;
+
+/**
+ * Obtém a estrutura que contém um LinkIlist.
+ *
+ * @param ptr ponteiro LinkIlist embutido.
+ * @param type tipo da estrutura que o contém.
+ * @param member nome do campo LinkIlist em type.
+ */
+#define CONTAINERILST(ptr, type, member) \
+    ((type *) ((char *) (ptr) - offsetof(type, member)))
+
+/**
+ * Percorre a lista do primeiro ao último elo.
+ *
+ * O elo corrente não pode ser desligado dentro do laço.
+ *
+ * @param pos variável LinkIlist* que recebe cada elo.
+ * @param head ponteiro LinkIlist da cabeça.
+ */
+#define FOREACHILST(pos, head) \
+    for ((pos) = (head)->next; (pos) != (head); (pos) = (pos)->next)
+
+/**
+ * Percorre a lista do último ao primeiro elo.
+ *
+ * @param pos variável LinkIlist* que recebe cada elo.
+ * @param head ponteiro LinkIlist da cabeça.
+ */
+#define FOREACHREVILST(pos, head) \
+    for ((pos) = (head)->prev; (pos) != (head); (pos) = (pos)->prev)
+
+/**
+ * Percorre a lista permitindo desligar o elo corrente.
+ *
+ * @param pos variável LinkIlist* que recebe cada elo.
+ * @param tmp variável LinkIlist* auxiliar.
+ * @param head ponteiro LinkIlist da cabeça.
+ */
+#define FOREACHSAFEILST(pos, tmp, head) \
+    for ((pos) = (head)->next, (tmp) = (pos)->next; (pos) != (head); (pos) = (tmp), (tmp) = (pos)->next)
+
+/**
+ * Inicializa cabeça de lista ou elo desligado.
+ *
+ * Um elo inicializado aponta para si mesmo.
+ *
+ * @param link ponteiro LinkIlist a ser inicializado.
+ */
+static inline void initilst(LinkIlist *link) {
+    link->next = link->prev = link;
+}
+
+/**
+ * Verifica se lista está vazia.
+ *
+ * @param head ponteiro LinkIlist da cabeça.
+ * @return int 1 caso vazia, 0 caso contrário.
+ */
+static inline int isemptyilst(const LinkIlist *head) {
+    return head->next == head;
+}
+
+/**
+ * Verifica se elo está em alguma lista.
+ *
+ * Vale apenas para elos inicializados com initilst ou desligados
+ * com unlinkilst.
+ *
+ * @param link ponteiro LinkIlist do elo.
+ * @return int 1 caso ligado, 0 caso contrário.
+ */
+static inline int islinkedilst(const LinkIlist *link) {
+    return link->next != link;
+}
+
+/**
+ * Insere elo depois de outro.
+ *
+ * @param pos ponteiro LinkIlist já na lista (ou a cabeça).
+ * @param link ponteiro LinkIlist a ser inserido.
+ */
+static inline void insertafterilst(LinkIlist *pos, LinkIlist *link) {
+    link->prev = pos;
+    link->next = pos->next;
+    pos->next->prev = link;
+    pos->next = link;
+}
+
+/**
+ * Insere elo antes de outro.
+ *
+ * @param pos ponteiro LinkIlist já na lista (ou a cabeça).
+ * @param link ponteiro LinkIlist a ser inserido.
+ */
+static inline void insertbeforeilst(LinkIlist *pos, LinkIlist *link) {
+    insertafterilst(pos->prev, link);
+}
+
+/**
+ * Insere elo no início da lista.
+ *
+ * @param head ponteiro LinkIlist da cabeça.
+ * @param link ponteiro LinkIlist a ser inserido.
+ */
+static inline void insertfirstilst(LinkIlist *head, LinkIlist *link) {
+    insertafterilst(head, link);
+}
+
+/**
+ * Insere elo no final da lista.
+ *
+ * @param head ponteiro LinkIlist da cabeça.
+ * @param link ponteiro LinkIlist a ser inserido.
+ */
+static inline void insertlastilst(LinkIlist *head, LinkIlist *link) {
+    insertafterilst(head->prev, link);
+}
+
+/**
+ * Desliga elo da lista em que está.
+ *
+ * Não precisa da cabeça nem de busca. O elo volta ao estado
+ * inicializado.
+ *
+ * @param link ponteiro LinkIlist a ser desligado.
+ */
+static inline void unlinkilst(LinkIlist *link) {
+    link->prev->next = link->next;
+    link->next->prev = link->prev;
+    initilst(link);
+}
+
+/**
+ * Move todos os elos de uma lista para depois de um elo.
+ *
+ * src fica vazia. Executa em tempo constante.
+ *
+ * @param pos ponteiro LinkIlist de destino (elo ou cabeça).
+ * @param src ponteiro LinkIlist da cabeça da lista de origem.
+ */
+static inline void spliceilst(LinkIlist *pos, LinkIlist *src) {
+    LinkIlist *first, *last;
+
+    if (isemptyilst(src)) return;
+
+    first = src->next;
+    last = src->prev;
+    first->prev = pos;
+    last->next = pos->next;
+    pos->next->prev = last;
+    pos->next = first;
+    initilst(src);
+}
+
+/**
+ * Ver tamanho da lista.
+ *
+ * Percorre a lista inteira.
+ *
+ * @param head ponteiro LinkIlist da cabeça.
+ * @return int quantidade de elos da lista.
+ */
+static inline int lenilst(const LinkIlist *head) {
+    const LinkIlist *ptr;
+    int n = 0;
+
+    for (ptr = head->next; ptr != head; ptr = ptr->next) n++;
+    return n;
+}
+
+#endif
@@ -0,0 +1,76 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include "ilinkedlist.h"
+
+// Cada item participa de duas listas ao mesmo tempo.
+typedef struct {
+    int value;
+    LinkIlist all, even;
+} Item;
+
+void print(LinkIlist *head, int even) {
+    LinkIlist *pos;
+
+    printf("\n[ ");
+    FOREACHILST(pos, head) {
+        if (even) printf("(%d) ", CONTAINERILST(pos, Item, even)->value);
+        else printf("(%d) ", CONTAINERILST(pos, Item, all)->value);
+    }
+    printf("]\n");
+}
+
+// dummy test
+int main() {
+    Item items[6];
+    LinkIlist all, even, other, *pos, *tmp;
+    int i;
+
+    initilst(&all);
+    initilst(&even);
+    initilst(&other);
+
+    // Liga os itens nas listas sem alocar memória.
+    // Output: [ (0) (1) (2) (3) (4) ] e [ (0) (2) (4) ]
+    for (i = 0; i < 5; i++) {
+        items[i].value = i;
+        initilst(&items[i].even);
+        insertlastilst(&all, &items[i].all);
+        if (i % 2 == 0) insertlastilst(&even, &items[i].even);
+    }
+    print(&all, 0);
+    print(&even, 1);
+
+    // Desliga o item 2 da lista de pares sem percorrê-la e insere
+    // o item 5 antes do item 1.
+    // Output: [ (0) (4) ] e [ (0) (5) (1) (2) (3) (4) ]
+    unlinkilst(&items[2].even);
+    items[5].value = 5;
+    insertbeforeilst(&items[1].all, &items[5].all);
+    print(&even, 1);
+    print(&all, 0);
+
+    // Remove durante o percurso os itens maiores que 2.
+    // Output: [ (0) (1) (2) ], 3 na outra lista
+    FOREACHSAFEILST(pos, tmp, &all) {
+        if (CONTAINERILST(pos, Item, all)->value > 2) {
+            unlinkilst(pos);
+            insertlastilst(&other, pos);
+        }
+    }
+    print(&all, 0);
+    printf("%d na outra lista\n", lenilst(&other));
+
+    // Junta a outra lista depois do primeiro item.
+    // Output: [ (0) (5) (3) (4) (1) (2) ]
+    spliceilst(all.next, &other);
+    print(&all, 0);
+
+    return 0;
+}
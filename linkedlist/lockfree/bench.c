@@ -0,0 +1,155 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "lflinkedlist.h"
+#include "../singlylinked/linkedlist.h"
+
+#define KEYRANGE 1024
+#define OPS 200000
+
+// Compilar com:
+//   gcc -O2 -pthread bench.c lflinkedlist.c ../singlylinked/linkedlist.c
+
+typedef struct {
+    int contains, insert;   // porcentagens; o restante é remoção
+} Mix;
+
+typedef struct {
+    int kind;               // 0 lock-free, 1 List + mutex, 2 List + rwlock
+    Mix mix;
+    unsigned seed;
+} Job;
+
+Lflist *lflst;
+List *lst;
+pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_rwlock_t rwlock = PTHREAD_RWLOCK_INITIALIZER;
+
+unsigned xorshift(unsigned *s) {
+    *s ^= *s << 13;
+    *s ^= *s >> 17;
+    *s ^= *s << 5;
+    return *s;
+}
+
+// Operações sobre List protegida pela trava escolhida.
+int listop(int kind, int op, int key) {
+    InfoList info, *removed;
+    int pos, ret = 0;
+
+    info.value = key;
+    if (op == 0) {
+        if (kind == 1) pthread_mutex_lock(&mutex);
+        else pthread_rwlock_rdlock(&rwlock);
+        ret = isinlst(lst, &info);
+    }
+    else {
+        if (kind == 1) pthread_mutex_lock(&mutex);
+        else pthread_rwlock_wrlock(&rwlock);
+        if (op == 1) {
+            if (!isinlst(lst, &info)) ret = insertfirstlst(lst, lstinfo(key));
+        }
+        else {
+            pos = positionlst(lst, &info);
+            if (pos >= 0) {
+                removed = delpositionlst(lst, pos + 1);
+                free(removed);
+                ret = 1;
+            }
+        }
+    }
+    if (kind == 1) pthread_mutex_unlock(&mutex);
+    else pthread_rwlock_unlock(&rwlock);
+    return ret;
+}
+
+void *worker(void *arg) {
+    Job *job = (Job *) arg;
+    int i, r, key, op, tid = -1;
+
+    if (job->kind == 0) tid = registerlflst(lflst);
+    for (i = 0; i < OPS; i++) {
+        r = xorshift(&job->seed) % 100;
+        key = xorshift(&job->seed) % KEYRANGE;
+        op = r < job->mix.contains ? 0 : r < job->mix.contains + job->mix.insert ? 1 : 2;
+
+        if (job->kind != 0) listop(job->kind, op, key);
+        else if (op == 0) containslflst(lflst, tid, key);
+        else if (op == 1) insertlflst(lflst, tid, key);
+        else deletelflst(lflst, tid, key);
+    }
+    if (job->kind == 0) unregisterlflst(lflst, tid);
+    return NULL;
+}
+
+double run(int kind, Mix mix, int nthreads) {
+    pthread_t threads[LFLST_MAXTHREADS];
+    Job jobs[LFLST_MAXTHREADS];
+    struct timespec t0, t1;
+    int i, tid;
+
+    // Pré-carrega metade das chaves.
+    if (kind == 0) {
+        lflst = createlflst();
+        tid = registerlflst(lflst);
+        for (i = 0; i < KEYRANGE; i += 2) insertlflst(lflst, tid, i);
+        unregisterlflst(lflst, tid);
+    }
+    else {
+        lst = createlst();
+        for (i = 0; i < KEYRANGE; i += 2) insertfirstlst(lst, lstinfo(i));
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (i = 0; i < nthreads; i++) {
+        jobs[i].kind = kind;
+        jobs[i].mix = mix;
+        jobs[i].seed = 2463534242u + i * 7919;
+        pthread_create(&threads[i], NULL, worker, &jobs[i]);
+    }
+    for (i = 0; i < nthreads; i++) pthread_join(threads[i], NULL);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    if (kind == 0) destroylflst(lflst);
+    else destroylst(lst);
+
+    return (double) nthreads * OPS /
+           ((t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9);
+}
+
+int main() {
+    Mix mixes[] = { {90, 5}, {50, 25} };
+    int ncpu, nthreads, m;
+
+    ncpu = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    if (ncpu > LFLST_MAXTHREADS) ncpu = LFLST_MAXTHREADS;
+
+    for (m = 0; m < 2; m++) {
+        printf("\ncontains/insert/delete = %d/%d/%d, %d chaves\n",
+               mixes[m].contains, mixes[m].insert,
+               100 - mixes[m].contains - mixes[m].insert, KEYRANGE);
+        printf("%8s %16s %16s %16s\n", "threads", "lock-free op/s", "mutex op/s", "rwlock op/s");
+
+        for (nthreads = 1; ; nthreads *= 2) {
+            if (nthreads > ncpu) nthreads = ncpu;
+            printf("%8d %16.0f %16.0f %16.0f\n", nthreads,
+                   run(0, mixes[m], nthreads),
+                   run(1, mixes[m], nthreads),
+                   run(2, mixes[m], nthreads));
+            if (nthreads == ncpu) break;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,416 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lflinkedlist.h"
+
+/**
+ * Quantidade de nós retirados entre tentativas de avançar a época.
+ */
+#define LFLST_ADVANCE 64
+
+#define ISMARKED(p) ((p) & (uintptr_t) 1)
+#define MARK(p) ((p) | (uintptr_t) 1)
+#define UNMARK(p) ((p) & ~(uintptr_t) 1)
+#define NODE(p) ((NodeLflist *) UNMARK(p))
+
+/**
+ * Libera todos os nós de um saco de reclamação.
+ *
+ * @param bag ponteiro BagLflist a ser esvaziado.
+ */
+static void freebaglflst(BagLflist *bag) {
+    int i;
+
+    for (i = 0; i < bag->count; i++) free(bag->nodes[i]);
+    bag->count = 0;
+}
+
+/**
+ * Tenta avançar a época global.
+ *
+ * A época só avança quando todas as threads ativas já
+ * observaram a época corrente.
+ *
+ * @param lst ponteiro Lflist da lista.
+ */
+static void advancelflst(Lflist *lst) {
+    unsigned e;
+    int i;
+
+    e = atomic_load(&lst->epoch);
+    for (i = 0; i < LFLST_MAXTHREADS; i++) {
+        ThreadLflist *rec = &lst->thread[i];
+        if (atomic_load(&rec->used) && atomic_load(&rec->active)
+            && atomic_load(&rec->epoch) != e) return;
+    }
+    atomic_compare_exchange_strong(&lst->epoch, &e, e + 1);
+}
+
+/**
+ * Libera sacos cujo período de carência já terminou.
+ *
+ * Um nó retirado na época e pode ser liberado quando a época
+ * global chega a e + 2: nenhuma thread ativa pode mais
+ * alcançá-lo.
+ *
+ * @param lst ponteiro Lflist da lista.
+ * @param rec ponteiro ThreadLflist da thread corrente.
+ */
+static void reclaimlflst(Lflist *lst, ThreadLflist *rec) {
+    unsigned e;
+    int i;
+
+    e = atomic_load(&lst->epoch);
+    for (i = 0; i < 3; i++) {
+        if (rec->bag[i].count && e - rec->bag[i].epoch >= 2) freebaglflst(&rec->bag[i]);
+    }
+}
+
+/**
+ * Entra em seção crítica.
+ *
+ * @param lst ponteiro Lflist da lista.
+ * @param rec ponteiro ThreadLflist da thread corrente.
+ */
+static void enterlflst(Lflist *lst, ThreadLflist *rec) {
+    atomic_store(&rec->active, 1);
+    atomic_store(&rec->epoch, atomic_load(&lst->epoch));
+}
+
+/**
+ * Sai de seção crítica.
+ *
+ * @param rec ponteiro ThreadLflist da thread corrente.
+ */
+static void exitlflst(ThreadLflist *rec) {
+    atomic_store_explicit(&rec->active, 0, memory_order_release);
+}
+
+/**
+ * Retira nó desligado da lista.
+ *
+ * O nó é marcado com a época global corrente e guardado até
+ * que o período de carência termine.
+ *
+ * @param lst ponteiro Lflist da lista.
+ * @param rec ponteiro ThreadLflist da thread corrente.
+ * @param node ponteiro NodeLflist desligado da lista.
+ */
+static void retirelflst(Lflist *lst, ThreadLflist *rec, NodeLflist *node) {
+    BagLflist *bag;
+    NodeLflist **nodes;
+    unsigned e;
+    int cap;
+
+    e = atomic_load(&lst->epoch);
+    bag = &rec->bag[e % 3];
+    if (bag->count && bag->epoch != e) freebaglflst(bag);
+    bag->epoch = e;
+
+    if (bag->count == bag->capacity) {
+        cap = bag->capacity ? bag->capacity * 2 : LFLST_ADVANCE;
+        nodes = (NodeLflist **) realloc(bag->nodes, cap * sizeof(NodeLflist *));
+        // Sem memória não há como liberar o nó com segurança; ele
+        // é abandonado, o que não compromete a lista.
+        if (!nodes) return;
+        bag->nodes = nodes;
+        bag->capacity = cap;
+    }
+    bag->nodes[bag->count++] = node;
+
+    if (++rec->retires % LFLST_ADVANCE == 0) {
+        advancelflst(lst);
+        reclaimlflst(lst, rec);
+    }
+}
+
+/**
+ * Busca posição de um valor.
+ *
+ * Encontra o primeiro nó não marcado com valor maior ou igual a
+ * value e o campo next que aponta para ele, desligando os nós
+ * marcados encontrados no caminho.
+ *
+ * @param lst ponteiro Lflist da lista.
+ * @param rec ponteiro ThreadLflist da thread corrente.
+ * @param value valor inteiro buscado.
+ * @param cur ponteiro onde gravar o nó encontrado (ou NULL).
+ * @return _Atomic uintptr_t* campo que aponta para cur.
+ */
+static _Atomic uintptr_t *searchlflst(Lflist *lst, ThreadLflist *rec, int value,
+                                      NodeLflist **cur) {
+    _Atomic uintptr_t *prev;
+    uintptr_t ptr, next;
+
+retry:
+    prev = &lst->first;
+    ptr = atomic_load_explicit(prev, memory_order_acquire);
+
+    while (1) {
+        if (!ptr) {
+            *cur = NULL;
+            return prev;
+        }
+        next = atomic_load_explicit(&NODE(ptr)->next, memory_order_acquire);
+
+        if (ISMARKED(next)) {
+            if (!atomic_compare_exchange_strong(prev, &ptr, UNMARK(next))) goto retry;
+            retirelflst(lst, rec, NODE(ptr));
+            ptr = UNMARK(next);
+        }
+        else {
+            if (NODE(ptr)->value >= value) {
+                *cur = NODE(ptr);
+                return prev;
+            }
+            prev = &NODE(ptr)->next;
+            ptr = next;
+        }
+    }
+}
+
+/**
+ * Cria cabeça de lista.
+ *
+ * @return Lflist* pointer para lista criada, ou NULL caso falhe.
+ */
+Lflist *createlflst() {
+    Lflist *ptr;
+    ptr = (Lflist *) aligned_alloc(64, sizeof(Lflist));
+
+    if (ptr) {
+        memset(ptr, 0, sizeof(Lflist));
+        atomic_init(&ptr->first, 0);
+        atomic_init(&ptr->size, 0);
+        atomic_init(&ptr->epoch, 0);
+        return ptr;
+    }
+    return NULL;
+}
+
+/**
+ * Destroi lista.
+ *
+ * Libera todos os nós, inclusive os aguardando reclamação.
+ * Não deve ser chamada com outras threads usando a lista.
+ *
+ * @param lst ponteiro Lflist da lista.
+ */
+void destroylflst(Lflist *lst) {
+    NodeLflist *ptr, *next;
+    int i, j;
+
+    if (!lst) return;
+
+    for (ptr = NODE(atomic_load(&lst->first)); ptr; ptr = next) {
+        next = NODE(atomic_load(&ptr->next));
+        free(ptr);
+    }
+    for (i = 0; i < LFLST_MAXTHREADS; i++) {
+        for (j = 0; j < 3; j++) {
+            freebaglflst(&lst->thread[i].bag[j]);
+            free(lst->thread[i].bag[j].nodes);
+        }
+    }
+    free(lst);
+}
+
+/**
+ * Registra thread na lista.
+ *
+ * Toda thread deve se registrar antes de operar na lista e usar
+ * o identificador retornado nas chamadas seguintes.
+ *
+ * @param lst ponteiro Lflist da lista.
+ * @return int identificador da thread, ou -1 caso não haja vagas.
+ */
+int registerlflst(Lflist *lst) {
+    int i, expected;
+
+    if (!lst) return -1;
+
+    for (i = 0; i < LFLST_MAXTHREADS; i++) {
+        expected = 0;
+        if (atomic_compare_exchange_strong(&lst->thread[i].used, &expected, 1)) {
+            atomic_store(&lst->thread[i].active, 0);
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Cancela registro de thread.
+ *
+ * Nós ainda não reclamados permanecem com o registro e são
+ * liberados por quem reutilizá-lo ou por destroylflst.
+ *
+ * @param lst ponteiro Lflist da lista.
+ * @param tid identificador retornado por registerlflst.
+ */
+void unregisterlflst(Lflist *lst, int tid) {
+    if (!lst || tid < 0 || tid >= LFLST_MAXTHREADS) return;
+
+    reclaimlflst(lst, &lst->thread[tid]);
+    atomic_store(&lst->thread[tid].active, 0);
+    atomic_store(&lst->thread[tid].used, 0);
+}
+
+/**
+ * Insere valor no conjunto (lock-free).
+ *
+ * @param lst ponteiro Lflist da lista.
+ * @param tid identificador da thread.
+ * @param value valor inteiro a ser inserido.
+ * @return int 1 caso inserido, 0 caso já exista ou falhe.
+ */
+int insertlflst(Lflist *lst, int tid, int value) {
+    ThreadLflist *rec;
+    NodeLflist *node, *cur;
+    _Atomic uintptr_t *prev;
+    uintptr_t expected;
+
+    if (!lst || tid < 0 || tid >= LFLST_MAXTHREADS) return 0;
+    node = (NodeLflist *) malloc(sizeof(NodeLflist));
+    if (!node) return 0;
+    node->value = value;
+
+    rec = &lst->thread[tid];
+    enterlflst(lst, rec);
+    while (1) {
+        prev = searchlflst(lst, rec, value, &cur);
+        if (cur && cur->value == value) {
+            exitlflst(rec);
+            free(node);
+            return 0;
+        }
+
+        atomic_init(&node->next, (uintptr_t) cur);
+        expected = (uintptr_t) cur;
+        if (atomic_compare_exchange_strong_explicit(prev, &expected, (uintptr_t) node,
+                                                    memory_order_release,
+                                                    memory_order_relaxed)) break;
+    }
+    exitlflst(rec);
+
+    atomic_fetch_add_explicit(&lst->size, 1, memory_order_relaxed);
+    return 1;
+}
+
+/**
+ * Remove valor do conjunto (lock-free).
+ *
+ * Marca o nó como removido e em seguida tenta desligá-lo da
+ * lista. O nó é liberado após um período de carência.
+ *
+ * @param lst ponteiro Lflist da lista.
+ * @param tid identificador da thread.
+ * @param value valor inteiro a ser removido.
+ * @return int 1 caso removido, 0 caso não exista.
+ */
+int deletelflst(Lflist *lst, int tid, int value) {
+    ThreadLflist *rec;
+    NodeLflist *cur;
+    _Atomic uintptr_t *prev;
+    uintptr_t next, expected;
+
+    if (!lst || tid < 0 || tid >= LFLST_MAXTHREADS) return 0;
+
+    rec = &lst->thread[tid];
+    enterlflst(lst, rec);
+    while (1) {
+        prev = searchlflst(lst, rec, value, &cur);
+        if (!cur || cur->value != value) {
+            exitlflst(rec);
+            return 0;
+        }
+
+        // Remoção lógica: marca o campo next do nó.
+        next = atomic_load_explicit(&cur->next, memory_order_acquire);
+        if (ISMARKED(next)) continue;
+        if (atomic_compare_exchange_strong(&cur->next, &next, MARK(next))) break;
+    }
+
+    // Remoção física: desliga o nó ou deixa para a próxima busca.
+    expected = (uintptr_t) cur;
+    if (atomic_compare_exchange_strong(prev, &expected, next)) retirelflst(lst, rec, cur);
+    else searchlflst(lst, rec, value, &cur);
+    exitlflst(rec);
+
+    atomic_fetch_sub_explicit(&lst->size, 1, memory_order_relaxed);
+    return 1;
+}
+
+/**
+ * Verifica presença de valor no conjunto (wait-free).
+ *
+ * @param lst ponteiro Lflist da lista.
+ * @param tid identificador da thread.
+ * @param value valor inteiro a ser buscado.
+ * @return int 1 caso exista, 0 caso contrário.
+ */
+int containslflst(Lflist *lst, int tid, int value) {
+    ThreadLflist *rec;
+    NodeLflist *ptr;
+    uintptr_t next;
+    int found;
+
+    if (!lst || tid < 0 || tid >= LFLST_MAXTHREADS) return 0;
+
+    rec = &lst->thread[tid];
+    enterlflst(lst, rec);
+
+    // Percorre sem ajudar remoções nem reiniciar.
+    ptr = NODE(atomic_load_explicit(&lst->first, memory_order_acquire));
+    while (ptr && ptr->value < value) {
+        ptr = NODE(atomic_load_explicit(&ptr->next, memory_order_acquire));
+    }
+    found = 0;
+    if (ptr && ptr->value == value) {
+        next = atomic_load_explicit(&ptr->next, memory_order_acquire);
+        found = !ISMARKED(next);
+    }
+
+    exitlflst(rec);
+    return found;
+}
+
+/**
+ * Ver tamanho da lista.
+ *
+ * @param lst ponteiro Lflist da lista.
+ * @return int Número de elementos. -1 caso lista não exista.
+ */
+int lenlflst(Lflist *lst) {
+    if (!lst) return -1;
+    return atomic_load_explicit(&lst->size, memory_order_relaxed);
+}
+
+/**
+ * Imprime elementos de lista.
+ *
+ * Não deve ser chamada com outras threads alterando a lista.
+ *
+ * @param lst ponteiro Lflist da lista.
+ */
+void printlflst(Lflist *lst) {
+    NodeLflist *ptr;
+    uintptr_t next;
+
+    if (!lst || lenlflst(lst) == 0) return;
+
+    printf("\n[ ");
+    for (ptr = NODE(atomic_load(&lst->first)); ptr; ptr = NODE(next)) {
+        next = atomic_load(&ptr->next);
+        if (!ISMARKED(next)) printf("(%d) ", ptr->value);
+    }
+    printf("]\n");
+}
@@ -0,0 +1,144 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef LFLINKEDLIST_H
+#define LFLINKEDLIST_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+/**
+ * Número máximo de threads registradas simultaneamente.
+ */
+#define LFLST_MAXTHREADS 64
+
+/**
+ * Estruturas de dados
+ *
+ * Conjunto ordenado de inteiros em lista encadeada sem travas
+ * (Harris-Michael). O bit menos significativo de next marca o nó
+ * como removido logicamente. Nós desligados são liberados por
+ * reclamação baseada em épocas (epoch-based reclamation).
+ */
+
+typedef struct lfnode {
+    int value;
+    _Atomic uintptr_t next;
+} NodeLflist;
+
+typedef struct {
+    NodeLflist **nodes;
+    int count, capacity;
+    unsigned epoch;
+} BagLflist;
+
+typedef struct {
+    _Alignas(64) _Atomic int used;
+    _Atomic int active;
+    _Atomic unsigned epoch;
+    BagLflist bag[3];
+    unsigned retires;
+} ThreadLflist;
+
+typedef struct {
+    _Atomic uintptr_t first;
+    _Atomic int size;
+    _Atomic unsigned epoch;
+    ThreadLflist thread[LFLST_MAXTHREADS];
+} Lflist;
+
+/**
+ * Cria cabeça de lista.
+ *
+ * @return Lflist* pointer para lista criada, ou NULL caso falhe.
+ */
+Lflist *createlflst();
+
+/**
+ * Destroi lista.
+ *
+ * Libera todos os nós, inclusive os aguardando reclamação.
+ * Não deve ser chamada com outras threads usando a lista.
+ *
+ * @param lst ponteiro Lflist da lista.
+ */
+void destroylflst(Lflist *lst);
+
+/**
+ * Registra thread na lista.
+ *
+ * Toda thread deve se registrar antes de operar na lista e usar
+ * o identificador retornado nas chamadas seguintes.
+ *
+ * @param lst ponteiro Lflist da lista.
+ * @return int identificador da thread, ou -1 caso não haja vagas.
+ */
+int registerlflst(Lflist *lst);
+
+/**
+ * Cancela registro de thread.
+ *
+ * Nós ainda não reclamados permanecem com o registro e são
+ * liberados por quem reutilizá-lo ou por destroylflst.
+ *
+ * @param lst ponteiro Lflist da lista.
+ * @param tid identificador retornado por registerlflst.
+ */
+void unregisterlflst(Lflist *lst, int tid);
+
+/**
+ * Insere valor no conjunto (lock-free).
+ *
+ * @param lst ponteiro Lflist da lista.
+ * @param tid identificador da thread.
+ * @param value valor inteiro a ser inserido.
+ * @return int 1 caso inserido, 0 caso já exista ou falhe.
+ */
+int insertlflst(Lflist *lst, int tid, int value);
+
+/**
+ * Remove valor do conjunto (lock-free).
+ *
+ * Marca o nó como removido e em seguida tenta desligá-lo da
+ * lista. O nó é liberado após um período de carência.
+ *
+ * @param lst ponteiro Lflist da lista.
+ * @param tid identificador da thread.
+ * @param value valor inteiro a ser removido.
+ * @return int 1 caso removido, 0 caso não exista.
+ */
+int deletelflst(Lflist *lst, int tid, int value);
+
+/**
+ * Verifica presença de valor no conjunto (wait-free).
+ *
+ * @param lst ponteiro Lflist da lista.
+ * @param tid identificador da thread.
+ * @param value valor inteiro a ser buscado.
+ * @return int 1 caso exista, 0 caso contrário.
+ */
+int containslflst(Lflist *lst, int tid, int value);
+
+/**
+ * Ver tamanho da lista.
+ *
+ * @param lst ponteiro Lflist da lista.
+ * @return int Número de elementos. -1 caso lista não exista.
+ */
+int lenlflst(Lflist *lst);
+
+/**
+ * Imprime elementos de lista.
+ *
+ * Não deve ser chamada com outras threads alterando a lista.
+ *
+ * @param lst ponteiro Lflist da lista.
+ */
+void printlflst(Lflist *lst);
+
+#endif
@@ -0,0 +1,67 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include <pthread.h>
+#include "lflinkedlist.h"
+
+#define NTHREADS 4
+#define PERTHREAD 2000
+
+Lflist *shared;
+
+// Cada thread insere uma faixa própria e remove os pares dela.
+void *worker(void *arg) {
+    int id = (int) (long) arg;
+    int tid = registerlflst(shared);
+    int i, base = id * PERTHREAD;
+
+    for (i = 0; i < PERTHREAD; i++) insertlflst(shared, tid, base + i);
+    for (i = 0; i < PERTHREAD; i += 2) deletelflst(shared, tid, base + i);
+
+    unregisterlflst(shared, tid);
+    return NULL;
+}
+
+// dummy test
+int main() {
+    pthread_t threads[NTHREADS];
+    int tid, i, missing = 0;
+
+    shared = createlflst();
+    tid = registerlflst(shared);
+
+    // Inserções fora de ordem resultam em conjunto ordenado.
+    // Output: [ (3) (17) (42) ]
+    insertlflst(shared, tid, 42);
+    insertlflst(shared, tid, 3);
+    insertlflst(shared, tid, 17);
+    insertlflst(shared, tid, 42);
+    printlflst(shared);
+
+    // Remove elementos do conjunto.
+    // Output: [ ] vazio, tamanho 0
+    deletelflst(shared, tid, 3);
+    deletelflst(shared, tid, 17);
+    deletelflst(shared, tid, 42);
+    printf("\nTamanho: %d\n", lenlflst(shared));
+
+    // Inserções e remoções concorrentes.
+    for (i = 0; i < NTHREADS; i++) pthread_create(&threads[i], NULL, worker, (void *) (long) i);
+    for (i = 0; i < NTHREADS; i++) pthread_join(threads[i], NULL);
+
+    // Output: Tamanho: 4000, faltando: 0
+    for (i = 0; i < NTHREADS * PERTHREAD; i++) {
+        if (containslflst(shared, tid, i) != (i % 2)) missing++;
+    }
+    printf("Tamanho: %d, faltando: %d\n", lenlflst(shared), missing);
+
+    unregisterlflst(shared, tid);
+    destroylflst(shared);
+    return missing != 0;
+}
@@ -0,0 +1,438 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "plinkedlist.h"
+
+/**
+ * Capacidade inicial do pool, em nós.
+ */
+#define PLST_MINCAP 16
+
+/**
+ * Obtém nó livre do pool.
+ *
+ * Reaproveita um nó da lista de livres ou, se não houver,
+ * consome o próximo nó nunca usado do pool, dobrando sua
+ * capacidade quando necessário.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param value valor inteiro a ser gravado no nó.
+ * @return uint32_t índice do nó, ou NILPLST caso falhe.
+ */
+static uint32_t plstnode(Plist *lst, int value) {
+    uint32_t idx, cap;
+    NodePlist *pool;
+
+    if (lst->free != NILPLST) {
+        idx = lst->free;
+        lst->free = lst->pool[idx].next;
+    }
+    else {
+        if (lst->used == lst->capacity) {
+            if (lst->capacity >= NILPLST / 2) return NILPLST;
+            cap = lst->capacity ? lst->capacity * 2 : PLST_MINCAP;
+            pool = (NodePlist *) realloc(lst->pool, cap * sizeof(NodePlist));
+            if (!pool) return NILPLST;
+            lst->pool = pool;
+            lst->capacity = cap;
+        }
+        idx = lst->used++;
+    }
+
+    lst->pool[idx].value = value;
+    lst->pool[idx].next = NILPLST;
+    return idx;
+}
+
+/**
+ * Devolve nó ao pool.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param idx índice do nó a ser liberado.
+ */
+static void freeplstnode(Plist *lst, uint32_t idx) {
+    lst->pool[idx].next = lst->free;
+    lst->free = idx;
+}
+
+/**
+ * Cria cabeça de lista.
+ *
+ * Essa função aloca memória e inicializa campos da struct
+ * para posterior utilização em lista encadeada por índices.
+ *
+ * @return Plist* pointer para lista criada.
+ */
+Plist *createplst() {
+    Plist *ptr;
+    ptr = (Plist *) malloc(sizeof(Plist));
+
+    if (ptr) {
+        ptr->size = 0;
+        ptr->first = ptr->last = NILPLST;
+        ptr->free = NILPLST;
+        ptr->used = ptr->capacity = 0;
+        ptr->pool = NULL;
+        return ptr;
+    }
+    return NULL;
+}
+
+/**
+ * Destroi lista.
+ *
+ * Libera a cabeça da lista e o pool de nós em uma única
+ * chamada, sem percorrer os elementos.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ */
+void destroyplst(Plist *lst) {
+    if (!lst) return;
+    free(lst->pool);
+    free(lst);
+}
+
+/**
+ * Verifica se lista está vazia.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @return int 1 caso vazia, 0 caso contrário.
+ */
+int isemptyplst(Plist *lst) {
+    return (!lst || lst->size == 0);
+}
+
+/**
+ * Verifica posição de informação.
+ *
+ * Percorre a lista encadeada para determinar em qual posição
+ * está contido um determinado valor, caso exista.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param value valor inteiro a ser buscado.
+ * @return int Número positivo indicando qual posição do valor.
+ *             -1 caso não seja encontrado.
+ */
+int positionplst(Plist *lst, int value) {
+    int pos;
+    uint32_t idx;
+
+    if (isemptyplst(lst)) return -1;
+
+    for (pos = 0, idx = lst->first; idx != NILPLST; pos++, idx = lst->pool[idx].next) {
+        if (lst->pool[idx].value == value) return pos;
+    }
+    return -1;
+}
+
+/**
+ * Verifica presença de informação na lista.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param value valor inteiro a ser buscado.
+ * @return int 1 caso exista na lista, 0 caso contrário.
+ */
+int isinplst(Plist *lst, int value) {
+    return findplst(lst, value) != NULL;
+}
+
+/**
+ * Encontra informação na lista.
+ *
+ * O ponteiro retornado aponta para dentro do pool e só é válido
+ * até a próxima inserção ou compactação da lista.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param value valor inteiro a ser buscado.
+ * @return int* pointer para o valor encontrado, ou NULL caso não exista.
+ */
+int *findplst(Plist *lst, int value) {
+    uint32_t idx;
+
+    if (isemptyplst(lst)) return NULL;
+
+    for (idx = lst->first; idx != NILPLST; idx = lst->pool[idx].next) {
+        if (lst->pool[idx].value == value) return &lst->pool[idx].value;
+    }
+    return NULL;
+}
+
+/**
+ * Ver tamanho da lista.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @return int Número indicando tamanho da lista. -1 caso lista não exista.
+ */
+int lenplst(Plist *lst) {
+    if (!lst) return -1;
+    return lst->size;
+}
+
+/**
+ * Imprime elementos de lista.
+ *
+ * Percorre uma lista encadeada e imprime todos os seus
+ * elementos em linha.
+ *
+ * @param lst ponteiro Plist para lista encadeada.
+ */
+void printplst(Plist *lst) {
+    uint32_t idx;
+
+    if (isemptyplst(lst)) return;
+
+    printf("\n[ ");
+    for (idx = lst->first; idx != NILPLST; idx = lst->pool[idx].next) {
+        printf("(%d) ", lst->pool[idx].value);
+    }
+    printf("]\n");
+}
+
+/**
+ * Insere valor no inicio da lista.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param value valor inteiro a ser gravado em nó.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertfirstplst(Plist *lst, int value) {
+    uint32_t idx;
+
+    if (!lst) return 0;
+    idx = plstnode(lst, value);
+    if (idx == NILPLST) return 0;
+
+    lst->pool[idx].next = lst->first;
+    lst->first = idx;
+    if (lst->last == NILPLST) lst->last = idx;
+    lst->size++;
+    return 1;
+}
+
+/**
+ * Insere valor no fim da lista.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param value valor inteiro a ser gravado em nó.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertlastplst(Plist *lst, int value) {
+    uint32_t idx;
+
+    if (!lst) return 0;
+    idx = plstnode(lst, value);
+    if (idx == NILPLST) return 0;
+
+    if (lst->first == NILPLST) lst->first = idx;
+    else lst->pool[lst->last].next = idx;
+    lst->last = idx;
+    lst->size++;
+    return 1;
+}
+
+/**
+ * Remove primeiro elemento da lista.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param value ponteiro onde gravar o valor removido (pode ser NULL).
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int delfirstplst(Plist *lst, int *value) {
+    return delpositionplst(lst, 1, value);
+}
+
+/**
+ * Remove elemento da lista a partir do valor armazenado.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param value valor inteiro a ser removido.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int delinfoplst(Plist *lst, int value) {
+    uint32_t idx, prev = NILPLST;
+
+    if (isemptyplst(lst)) return 0;
+
+    for (idx = lst->first; idx != NILPLST; prev = idx, idx = lst->pool[idx].next) {
+        if (lst->pool[idx].value == value) break;
+    }
+    if (idx == NILPLST) return 0;
+
+    if (prev == NILPLST) lst->first = lst->pool[idx].next;
+    else lst->pool[prev].next = lst->pool[idx].next;
+    if (lst->last == idx) lst->last = prev;
+
+    freeplstnode(lst, idx);
+    lst->size--;
+    return 1;
+}
+
+/**
+ * Remove elemento em uma posição da lista.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param pos inteiro com posição a ser removida (iniciando em 1).
+ * @param value ponteiro onde gravar o valor removido (pode ser NULL).
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int delpositionplst(Plist *lst, int pos, int *value) {
+    uint32_t idx, prev = NILPLST;
+    int count;
+
+    if (isemptyplst(lst) || pos > lst->size || pos <= 0) return 0;
+
+    idx = lst->first;
+    for (count = 1; count < pos; count++) {
+        prev = idx;
+        idx = lst->pool[idx].next;
+    }
+
+    if (prev == NILPLST) lst->first = lst->pool[idx].next;
+    else lst->pool[prev].next = lst->pool[idx].next;
+    if (lst->last == idx) lst->last = prev;
+
+    if (value) *value = lst->pool[idx].value;
+    freeplstnode(lst, idx);
+    lst->size--;
+    return 1;
+}
+
+/**
+ * Remove elemento na última posição da lista.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param value ponteiro onde gravar o valor removido (pode ser NULL).
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int dellastplst(Plist *lst, int *value) {
+    if (isemptyplst(lst)) return 0;
+    return delpositionplst(lst, lst->size, value);
+}
+
+/**
+ * Inverte a lista encadeada.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ */
+void reverseplst(Plist *lst) {
+    uint32_t prev = NILPLST, current, next;
+
+    if (isemptyplst(lst)) return;
+
+    lst->last = lst->first;
+    current = lst->first;
+    while (current != NILPLST) {
+        next = lst->pool[current].next;
+        lst->pool[current].next = prev;
+        prev = current;
+        current = next;
+    }
+    lst->first = prev;
+}
+
+/**
+ * Ordena lista.
+ *
+ * Realiza ordenação da lista utilizando merge sort sobre os
+ * índices de ligação, sem mover os valores no pool.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ */
+void sortplst(Plist *lst) {
+    NodePlist *pool;
+    uint32_t head, tail, p, q, e;
+    int insize, psize, qsize, nmerges;
+
+    if (isemptyplst(lst) || lst->size == 1) return;
+
+    pool = lst->pool;
+    head = lst->first;
+
+    // Merge sort iterativo: a cada passada intercala pares de
+    // sublistas de tamanho insize, dobrando insize em seguida.
+    for (insize = 1; ; insize *= 2) {
+        p = head;
+        head = tail = NILPLST;
+        nmerges = 0;
+
+        while (p != NILPLST) {
+            nmerges++;
+            q = p;
+            for (psize = 0; psize < insize && q != NILPLST; psize++) q = pool[q].next;
+            qsize = insize;
+
+            while (psize > 0 || (qsize > 0 && q != NILPLST)) {
+                if (psize == 0) {
+                    e = q; q = pool[q].next; qsize--;
+                }
+                else if (qsize == 0 || q == NILPLST || pool[p].value <= pool[q].value) {
+                    e = p; p = pool[p].next; psize--;
+                }
+                else {
+                    e = q; q = pool[q].next; qsize--;
+                }
+
+                if (tail != NILPLST) pool[tail].next = e;
+                else head = e;
+                tail = e;
+            }
+            p = q;
+        }
+        pool[tail].next = NILPLST;
+
+        if (nmerges <= 1) break;
+    }
+
+    lst->first = head;
+    lst->last = tail;
+}
+
+/**
+ * Compacta o pool da lista.
+ *
+ * Reescreve os nós no pool na ordem da lista, de forma que o
+ * elemento i fique no índice i e o percurso seja sequencial.
+ * Descarta os nós livres e reduz o pool ao tamanho da lista.
+ * Invalida ponteiros obtidos com findplst.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int compactplst(Plist *lst) {
+    NodePlist *pool;
+    uint32_t idx, i;
+
+    if (!lst) return 0;
+
+    if (lst->size == 0) {
+        free(lst->pool);
+        lst->pool = NULL;
+        lst->first = lst->last = lst->free = NILPLST;
+        lst->used = lst->capacity = 0;
+        return 1;
+    }
+
+    pool = (NodePlist *) malloc(lst->size * sizeof(NodePlist));
+    if (!pool) return 0;
+
+    for (i = 0, idx = lst->first; idx != NILPLST; i++, idx = lst->pool[idx].next) {
+        pool[i].value = lst->pool[idx].value;
+        pool[i].next = i + 1;
+    }
+    pool[i - 1].next = NILPLST;
+
+    free(lst->pool);
+    lst->pool = pool;
+    lst->first = 0;
+    lst->last = i - 1;
+    lst->free = NILPLST;
+    lst->used = lst->capacity = i;
+    return 1;
+}
@@ -0,0 +1,205 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef PLINKEDLIST_H
+#define PLINKEDLIST_H
+
+#include <stdint.h>
+
+/**
+ * Índice nulo, equivalente ao NULL das listas com ponteiros.
+ */
+#define NILPLST UINT32_MAX
+
+/**
+ * Estruturas de dados
+ *
+ * Os nós ficam em um vetor contíguo (pool) e são ligados por
+ * índices de 32 bits, com o valor armazenado no próprio nó.
+ * Cada elemento ocupa 8 bytes.
+ */
+
+typedef struct {
+    int value;
+    uint32_t next;
+} NodePlist;
+
+typedef struct {
+    int size;
+    uint32_t first, last;
+    uint32_t free;
+    uint32_t used, capacity;
+    NodePlist *pool;
+} Plist;
+
+/**
+ * Cria cabeça de lista.
+ *
+ * Essa função aloca memória e inicializa campos da struct
+ * para posterior utilização em lista encadeada por índices.
+ *
+ * @return Plist* pointer para lista criada.
+ */
+Plist *createplst();
+
+/**
+ * Destroi lista.
+ *
+ * Libera a cabeça da lista e o pool de nós em uma única
+ * chamada, sem percorrer os elementos.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ */
+void destroyplst(Plist *lst);
+
+/**
+ * Verifica se lista está vazia.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @return int 1 caso vazia, 0 caso contrário.
+ */
+int isemptyplst(Plist *lst);
+
+/**
+ * Verifica posição de informação.
+ *
+ * Percorre a lista encadeada para determinar em qual posição
+ * está contido um determinado valor, caso exista.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param value valor inteiro a ser buscado.
+ * @return int Número positivo indicando qual posição do valor.
+ *             -1 caso não seja encontrado.
+ */
+int positionplst(Plist *lst, int value);
+
+/**
+ * Verifica presença de informação na lista.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param value valor inteiro a ser buscado.
+ * @return int 1 caso exista na lista, 0 caso contrário.
+ */
+int isinplst(Plist *lst, int value);
+
+/**
+ * Encontra informação na lista.
+ *
+ * O ponteiro retornado aponta para dentro do pool e só é válido
+ * até a próxima inserção ou compactação da lista.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param value valor inteiro a ser buscado.
+ * @return int* pointer para o valor encontrado, ou NULL caso não exista.
+ */
+int *findplst(Plist *lst, int value);
+
+/**
+ * Ver tamanho da lista.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @return int Número indicando tamanho da lista. -1 caso lista não exista.
+ */
+int lenplst(Plist *lst);
+
+/**
+ * Imprime elementos de lista.
+ *
+ * Percorre uma lista encadeada e imprime todos os seus
+ * elementos em linha.
+ *
+ * @param lst ponteiro Plist para lista encadeada.
+ */
+void printplst(Plist *lst);
+
+/**
+ * Insere valor no inicio da lista.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param value valor inteiro a ser gravado em nó.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertfirstplst(Plist *lst, int value);
+
+/**
+ * Insere valor no fim da lista.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param value valor inteiro a ser gravado em nó.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertlastplst(Plist *lst, int value);
+
+/**
+ * Remove primeiro elemento da lista.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param value ponteiro onde gravar o valor removido (pode ser NULL).
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int delfirstplst(Plist *lst, int *value);
+
+/**
+ * Remove elemento da lista a partir do valor armazenado.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param value valor inteiro a ser removido.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int delinfoplst(Plist *lst, int value);
+
+/**
+ * Remove elemento em uma posição da lista.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param pos inteiro com posição a ser removida (iniciando em 1).
+ * @param value ponteiro onde gravar o valor removido (pode ser NULL).
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int delpositionplst(Plist *lst, int pos, int *value);
+
+/**
+ * Remove elemento na última posição da lista.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @param value ponteiro onde gravar o valor removido (pode ser NULL).
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int dellastplst(Plist *lst, int *value);
+
+/**
+ * Inverte a lista encadeada.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ */
+void reverseplst(Plist *lst);
+
+/**
+ * Ordena lista.
+ *
+ * Realiza ordenação da lista utilizando merge sort sobre os
+ * índices de ligação, sem mover os valores no pool.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ */
+void sortplst(Plist *lst);
+
+/**
+ * Compacta o pool da lista.
+ *
+ * Reescreve os nós no pool na ordem da lista, de forma que o
+ * elemento i fique no índice i e o percurso seja sequencial.
+ * Descarta os nós livres e reduz o pool ao tamanho da lista.
+ * Invalida ponteiros obtidos com findplst.
+ *
+ * @param lst ponteiro Plist da lista encadeada.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int compactplst(Plist *lst);
+
+#endif
@@ -0,0 +1,59 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include "plinkedlist.h"
+
+// dummy test
+int main() {
+    Plist *lst = createplst();
+    int value;
+
+    // Cria 4 nós.
+    insertlastplst(lst, 87);
+    insertlastplst(lst, 23);
+    insertlastplst(lst, 543);
+    insertfirstplst(lst, 7);
+
+    // Imprime lista com elementos adicionados.
+    // Output: [ (7) (87) (23) (543) ]
+    printplst(lst);
+
+    // Remove elemento na segunda posição e reaproveita o nó.
+    // Output: [ (7) (23) (543) (12) ]
+    delpositionplst(lst, 2, &value);
+    insertlastplst(lst, 12);
+    printplst(lst);
+
+    // Inverte elementos da lista.
+    // Output: [ (12) (543) (23) (7) ]
+    reverseplst(lst);
+    printplst(lst);
+
+    // Ordena elementos da lista.
+    // Output: [ (7) (12) (23) (543) ]
+    sortplst(lst);
+    printplst(lst);
+
+    // Compacta o pool na ordem da lista.
+    // Output: [ (7) (12) (23) (543) ] com índices 0 1 2 3
+    compactplst(lst);
+    printplst(lst);
+    printf("primeiro %u ultimo %u, %d bytes por no\n",
+           lst->first, lst->last, (int) sizeof(NodePlist));
+
+    // Remove elementos pelas pontas e por valor.
+    // Output: [ (12) ]
+    delfirstplst(lst, &value);
+    dellastplst(lst, &value);
+    delinfoplst(lst, 23);
+    printplst(lst);
+
+    destroyplst(lst);
+    return 0;
+}
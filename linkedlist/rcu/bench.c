@@ -0,0 +1,148 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "rculinkedlist.h"
+#include "../singlylinked/linkedlist.h"
+
+#define KEYRANGE 1000
+#define DURATION_MS 500
+#define QUIESCENT_EVERY 16
+
+// Compilar com:
+//   gcc -O2 -pthread bench.c rculinkedlist.c ../singlylinked/linkedlist.c
+
+Rculist *rculst;
+List *lst;
+pthread_rwlock_t rwlock = PTHREAD_RWLOCK_INITIALIZER;
+_Atomic int stop;
+int userculist;
+
+unsigned xorshift(unsigned *s) {
+    *s ^= *s << 13;
+    *s ^= *s >> 17;
+    *s ^= *s << 5;
+    return *s;
+}
+
+void *reader(void *arg) {
+    unsigned seed = (unsigned) (long) arg * 2654435761u + 1;
+    long ops = 0;
+    InfoList info;
+    int rid = -1;
+
+    if (userculist) rid = registerrculst(rculst);
+    while (!atomic_load_explicit(&stop, memory_order_relaxed)) {
+        info.value = xorshift(&seed) % KEYRANGE;
+        if (userculist) {
+            isinrculst(rculst, info.value);
+            if (++ops % QUIESCENT_EVERY == 0) quiescentrculst(rculst, rid);
+        }
+        else {
+            pthread_rwlock_rdlock(&rwlock);
+            isinlst(lst, &info);
+            pthread_rwlock_unlock(&rwlock);
+            ops++;
+        }
+    }
+    if (userculist) unregisterrculst(rculst, rid);
+    return (void *) ops;
+}
+
+// Escritor sempre ativo: remove e reinsere chaves aleatórias.
+void *writer(void *arg) {
+    unsigned seed = 88172645u;
+    InfoList info;
+    int key, pos;
+    long ops = 0;
+
+    (void) arg;
+    while (!atomic_load_explicit(&stop, memory_order_relaxed)) {
+        key = xorshift(&seed) % KEYRANGE;
+        if (userculist) {
+            if (delinforculst(rculst, key)) insertlastrculst(rculst, key);
+        }
+        else {
+            info.value = key;
+            pthread_rwlock_wrlock(&rwlock);
+            pos = positionlst(lst, &info);
+            if (pos >= 0) {
+                free(delpositionlst(lst, pos + 1));
+                insertfirstlst(lst, lstinfo(key));
+            }
+            pthread_rwlock_unlock(&rwlock);
+        }
+        ops++;
+    }
+    return (void *) ops;
+}
+
+double run(int rcu, int nreaders, double *wrate) {
+    pthread_t threads[RCULST_MAXREADERS], wthread;
+    struct timespec pause = { DURATION_MS / 1000, (DURATION_MS % 1000) * 1000000L };
+    void *ret;
+    long total = 0;
+    int i;
+
+    userculist = rcu;
+    atomic_store(&stop, 0);
+    if (rcu) {
+        rculst = createrculst();
+        for (i = 0; i < KEYRANGE; i++) insertlastrculst(rculst, i);
+    }
+    else {
+        lst = createlst();
+        for (i = 0; i < KEYRANGE; i++) insertfirstlst(lst, lstinfo(i));
+    }
+
+    pthread_create(&wthread, NULL, writer, NULL);
+    for (i = 0; i < nreaders; i++) pthread_create(&threads[i], NULL, reader, (void *) (long) (i + 1));
+    nanosleep(&pause, NULL);
+    atomic_store(&stop, 1);
+
+    for (i = 0; i < nreaders; i++) {
+        pthread_join(threads[i], &ret);
+        total += (long) ret;
+    }
+    pthread_join(wthread, &ret);
+    *wrate = (long) ret * 1000.0 / DURATION_MS;
+
+    if (rcu) destroyrculst(rculst);
+    else destroylst(lst);
+    return total * 1000.0 / DURATION_MS;
+}
+
+int main() {
+    int ncpu, nreaders;
+    double rcu, rw, wrcu, wrw;
+
+    // Um núcleo fica para o escritor.
+    ncpu = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    if (ncpu > RCULST_MAXREADERS) ncpu = RCULST_MAXREADERS;
+    if (ncpu < 2) ncpu = 2;
+
+    printf("%d chaves, 1 escritor ativo, %d ms por ponto\n", KEYRANGE, DURATION_MS);
+    printf("%8s %16s %12s %16s %12s %14s %14s\n", "leitores", "rcu leit/s",
+           "por leitor", "rwlock leit/s", "por leitor", "rcu escr/s", "rwlock escr/s");
+
+    for (nreaders = 1; ; nreaders *= 2) {
+        if (nreaders > ncpu - 1) nreaders = ncpu - 1;
+        rcu = run(1, nreaders, &wrcu);
+        rw = run(0, nreaders, &wrw);
+        printf("%8d %16.0f %12.0f %16.0f %12.0f %14.0f %14.0f\n", nreaders,
+               rcu, rcu / nreaders, rw, rw / nreaders, wrcu, wrw);
+        if (nreaders == ncpu - 1) break;
+    }
+    return 0;
+}
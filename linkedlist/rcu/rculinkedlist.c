@@ -0,0 +1,478 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <sched.h>
+#include "rculinkedlist.h"
+
+/**
+ * Valor de seen para leitores offline.
+ */
+#define RCULST_OFFLINE ULONG_MAX
+
+/**
+ * Leitura de ponteiro por leitores.
+ *
+ * memory_order_consume só ordena acessos dependentes do ponteiro
+ * lido; em x86 e ARM isso é um load comum.
+ */
+#define RCUDEREF(p) atomic_load_explicit(&(p), memory_order_consume)
+
+/**
+ * Publicação de ponteiro por escritores.
+ */
+#define RCUASSIGN(p, v) atomic_store_explicit(&(p), (v), memory_order_release)
+
+/**
+ * Libera lista de nós removidos.
+ *
+ * @param batch ponteiro NodeRculist do primeiro nó do lote.
+ */
+static void freebatchrculst(NodeRculist *batch) {
+    NodeRculist *next;
+
+    for (; batch; batch = next) {
+        next = batch->retired;
+        free(batch);
+    }
+}
+
+/**
+ * Verifica se todos os leitores online já observaram um período.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param target período a ser observado.
+ * @return int 1 caso o período de carência tenha terminado.
+ */
+static int elapsedrculst(Rculist *lst, unsigned long target) {
+    unsigned long seen;
+    int i;
+
+    for (i = 0; i < RCULST_MAXREADERS; i++) {
+        if (!atomic_load(&lst->reader[i].used)) continue;
+        seen = atomic_load_explicit(&lst->reader[i].seen, memory_order_acquire);
+        if (seen != RCULST_OFFLINE && seen < target) return 0;
+    }
+    return 1;
+}
+
+/**
+ * Guarda nó removido até o fim do período de carência.
+ *
+ * Com o lote cheio, libera o lote anterior caso seu período já
+ * tenha terminado e inicia um novo período para o lote atual.
+ * Nunca aguarda leitores. Deve ser chamada com a trava de escrita
+ * adquirida.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param node ponteiro NodeRculist já desligado da lista.
+ */
+static void retirerculst(Rculist *lst, NodeRculist *node) {
+    node->retired = lst->retired;
+    lst->retired = node;
+    if (++lst->nretired < RCULST_BATCH) return;
+
+    if (lst->waiting && elapsedrculst(lst, lst->waitgp)) {
+        freebatchrculst(lst->waiting);
+        lst->waiting = NULL;
+    }
+    if (!lst->waiting) {
+        lst->waiting = lst->retired;
+        lst->waitgp = atomic_fetch_add(&lst->gp, 1) + 1;
+        lst->retired = NULL;
+        lst->nretired = 0;
+    }
+}
+
+/**
+ * Cria cabeça de lista.
+ *
+ * @return Rculist* pointer para lista criada, ou NULL caso falhe.
+ */
+Rculist *createrculst() {
+    Rculist *ptr;
+    int i;
+
+    ptr = (Rculist *) aligned_alloc(64, sizeof(Rculist));
+    if (!ptr) return NULL;
+
+    if (pthread_mutex_init(&ptr->lock, NULL) != 0) {
+        free(ptr);
+        return NULL;
+    }
+    atomic_init(&ptr->first, NULL);
+    atomic_init(&ptr->size, 0);
+    atomic_init(&ptr->gp, 0);
+    ptr->last = NULL;
+    ptr->retired = ptr->waiting = NULL;
+    ptr->nretired = 0;
+    ptr->waitgp = 0;
+    for (i = 0; i < RCULST_MAXREADERS; i++) {
+        atomic_init(&ptr->reader[i].seen, RCULST_OFFLINE);
+        atomic_init(&ptr->reader[i].used, 0);
+    }
+    return ptr;
+}
+
+/**
+ * Destroi lista.
+ *
+ * Não deve ser chamada com leitores ou escritores ativos.
+ *
+ * @param lst ponteiro Rculist da lista.
+ */
+void destroyrculst(Rculist *lst) {
+    NodeRculist *ptr, *next;
+
+    if (!lst) return;
+
+    for (ptr = atomic_load(&lst->first); ptr; ptr = next) {
+        next = atomic_load(&ptr->next);
+        free(ptr);
+    }
+    freebatchrculst(lst->retired);
+    freebatchrculst(lst->waiting);
+    pthread_mutex_destroy(&lst->lock);
+    free(lst);
+}
+
+/**
+ * Registra thread leitora.
+ *
+ * O leitor começa online e deve chamar quiescentrculst
+ * periodicamente, fora de qualquer percurso da lista.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @return int identificador do leitor, ou -1 caso não haja vagas.
+ */
+int registerrculst(Rculist *lst) {
+    int i, expected;
+
+    if (!lst) return -1;
+
+    for (i = 0; i < RCULST_MAXREADERS; i++) {
+        expected = 0;
+        if (atomic_compare_exchange_strong(&lst->reader[i].used, &expected, 1)) {
+            onlinerculst(lst, i);
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Cancela registro de thread leitora.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param rid identificador retornado por registerrculst.
+ */
+void unregisterrculst(Rculist *lst, int rid) {
+    if (!lst || rid < 0 || rid >= RCULST_MAXREADERS) return;
+
+    offlinerculst(lst, rid);
+    atomic_store(&lst->reader[rid].used, 0);
+}
+
+/**
+ * Informa estado quiescente.
+ *
+ * Indica que o leitor não guarda referências a nós da lista.
+ * Ponteiros obtidos com findrculst deixam de ser válidos.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param rid identificador do leitor.
+ */
+void quiescentrculst(Rculist *lst, int rid) {
+    // Load de aquisição: quem observa o novo período sincroniza com
+    // o fetch_add do escritor, feito depois de desligar os nós, e
+    // não os encontra mais nas leituras seguintes. Store de
+    // liberação: as leituras anteriores terminam antes que o
+    // escritor veja o novo contador.
+    atomic_store_explicit(&lst->reader[rid].seen,
+                          atomic_load_explicit(&lst->gp, memory_order_acquire),
+                          memory_order_release);
+}
+
+/**
+ * Coloca leitor offline.
+ *
+ * Um leitor offline não atrasa períodos de carência e não pode
+ * ler a lista até chamar onlinerculst.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param rid identificador do leitor.
+ */
+void offlinerculst(Rculist *lst, int rid) {
+    atomic_store_explicit(&lst->reader[rid].seen, RCULST_OFFLINE, memory_order_release);
+}
+
+/**
+ * Coloca leitor online novamente.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param rid identificador do leitor.
+ */
+void onlinerculst(Rculist *lst, int rid) {
+    atomic_store(&lst->reader[rid].seen, atomic_load(&lst->gp));
+}
+
+/**
+ * Aguarda período de carência e libera nós removidos.
+ *
+ * Bloqueia até que todos os leitores online tenham passado por
+ * um estado quiescente. Não deve ser chamada por um leitor online:
+ * um leitor que também escreve deve chamar offlinerculst antes.
+ *
+ * @param lst ponteiro Rculist da lista.
+ */
+void synchronizerculst(Rculist *lst) {
+    NodeRculist *batch, *waiting;
+    unsigned long target;
+
+    if (!lst) return;
+
+    pthread_mutex_lock(&lst->lock);
+    batch = lst->retired;
+    waiting = lst->waiting;
+    lst->retired = lst->waiting = NULL;
+    lst->nretired = 0;
+    pthread_mutex_unlock(&lst->lock);
+
+    // Inicia novo período e espera cada leitor online observá-lo.
+    target = atomic_fetch_add(&lst->gp, 1) + 1;
+    while (!elapsedrculst(lst, target)) sched_yield();
+
+    freebatchrculst(batch);
+    freebatchrculst(waiting);
+}
+
+/**
+ * Verifica posição de informação (leitor).
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param value valor inteiro a ser buscado.
+ * @return int Número positivo indicando qual posição do valor.
+ *             -1 caso não seja encontrado.
+ */
+int positionrculst(Rculist *lst, int value) {
+    NodeRculist *ptr;
+    int pos;
+
+    if (!lst) return -1;
+
+    for (pos = 0, ptr = RCUDEREF(lst->first); ptr; pos++, ptr = RCUDEREF(ptr->next)) {
+        if (ptr->value == value) return pos;
+    }
+    return -1;
+}
+
+/**
+ * Verifica presença de informação na lista (leitor).
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param value valor inteiro a ser buscado.
+ * @return int 1 caso exista na lista, 0 caso contrário.
+ */
+int isinrculst(Rculist *lst, int value) {
+    return findrculst(lst, value) != NULL;
+}
+
+/**
+ * Encontra informação na lista (leitor).
+ *
+ * O nó retornado só é válido até o próximo estado quiescente
+ * do leitor.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param value valor inteiro a ser buscado.
+ * @return NodeRculist* pointer para nó encontrado, ou NULL caso não exista.
+ */
+NodeRculist *findrculst(Rculist *lst, int value) {
+    NodeRculist *ptr;
+
+    if (!lst) return NULL;
+
+    for (ptr = RCUDEREF(lst->first); ptr; ptr = RCUDEREF(ptr->next)) {
+        if (ptr->value == value) return ptr;
+    }
+    return NULL;
+}
+
+/**
+ * Ver tamanho da lista.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @return int Número indicando tamanho da lista. -1 caso lista não exista.
+ */
+int lenrculst(Rculist *lst) {
+    if (!lst) return -1;
+    return atomic_load_explicit(&lst->size, memory_order_relaxed);
+}
+
+/**
+ * Imprime elementos de lista (leitor).
+ *
+ * @param lst ponteiro Rculist da lista.
+ */
+void printrculst(Rculist *lst) {
+    NodeRculist *ptr;
+
+    if (lenrculst(lst) <= 0) return;
+
+    printf("\n[ ");
+    for (ptr = RCUDEREF(lst->first); ptr; ptr = RCUDEREF(ptr->next)) {
+        printf("(%d) ", ptr->value);
+    }
+    printf("]\n");
+}
+
+/**
+ * Insere valor no inicio da lista (escritor).
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param value valor inteiro a ser gravado em nó.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertfirstrculst(Rculist *lst, int value) {
+    NodeRculist *ptr;
+
+    if (!lst) return 0;
+    ptr = (NodeRculist *) malloc(sizeof(NodeRculist));
+    if (!ptr) return 0;
+
+    ptr->value = value;
+    ptr->retired = NULL;
+
+    pthread_mutex_lock(&lst->lock);
+    atomic_init(&ptr->next, atomic_load_explicit(&lst->first, memory_order_relaxed));
+    RCUASSIGN(lst->first, ptr);
+    if (!lst->last) lst->last = ptr;
+    atomic_fetch_add_explicit(&lst->size, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&lst->lock);
+    return 1;
+}
+
+/**
+ * Insere valor no fim da lista (escritor).
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param value valor inteiro a ser gravado em nó.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertlastrculst(Rculist *lst, int value) {
+    NodeRculist *ptr;
+
+    if (!lst) return 0;
+    ptr = (NodeRculist *) malloc(sizeof(NodeRculist));
+    if (!ptr) return 0;
+
+    ptr->value = value;
+    ptr->retired = NULL;
+    atomic_init(&ptr->next, NULL);
+
+    pthread_mutex_lock(&lst->lock);
+    if (!lst->last) RCUASSIGN(lst->first, ptr);
+    else RCUASSIGN(lst->last->next, ptr);
+    lst->last = ptr;
+    atomic_fetch_add_explicit(&lst->size, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&lst->lock);
+    return 1;
+}
+
+/**
+ * Desliga nó da lista (escritor).
+ *
+ * O campo next do nó removido é preservado para que leitores
+ * posicionados nele continuem o percurso normalmente.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param prev nó anterior, ou NULL caso seja o primeiro.
+ * @param ptr nó a ser removido.
+ */
+static void unlinkrculst(Rculist *lst, NodeRculist *prev, NodeRculist *ptr) {
+    NodeRculist *next;
+
+    next = atomic_load_explicit(&ptr->next, memory_order_relaxed);
+    if (!prev) RCUASSIGN(lst->first, next);
+    else RCUASSIGN(prev->next, next);
+    if (lst->last == ptr) lst->last = prev;
+
+    atomic_fetch_sub_explicit(&lst->size, 1, memory_order_relaxed);
+    retirerculst(lst, ptr);
+}
+
+/**
+ * Remove elemento da lista a partir do valor armazenado (escritor).
+ *
+ * Bloqueia apenas na trava de escrita e nunca aguarda leitores,
+ * podendo ser chamada por um leitor online. Nós removidos só são
+ * liberados depois que todos os leitores online passarem por um
+ * estado quiescente; enquanto algum leitor não o fizer, a memória
+ * retida cresce até synchronizerculst ser chamada.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param value valor inteiro a ser removido.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int delinforculst(Rculist *lst, int value) {
+    NodeRculist *ptr, *prev = NULL;
+    int found = 0;
+
+    if (!lst) return 0;
+
+    pthread_mutex_lock(&lst->lock);
+    for (ptr = atomic_load_explicit(&lst->first, memory_order_relaxed); ptr;
+         prev = ptr, ptr = atomic_load_explicit(&ptr->next, memory_order_relaxed)) {
+        if (ptr->value == value) {
+            unlinkrculst(lst, prev, ptr);
+            found = 1;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&lst->lock);
+    return found;
+}
+
+/**
+ * Remove elemento em uma posição da lista (escritor).
+ *
+ * Bloqueia apenas na trava de escrita e nunca aguarda leitores,
+ * podendo ser chamada por um leitor online. Nós removidos só são
+ * liberados depois que todos os leitores online passarem por um
+ * estado quiescente; enquanto algum leitor não o fizer, a memória
+ * retida cresce até synchronizerculst ser chamada.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param pos inteiro com posição a ser removida (iniciando em 1).
+ * @param value ponteiro onde gravar o valor removido (pode ser NULL).
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int delpositionrculst(Rculist *lst, int pos, int *value) {
+    NodeRculist *ptr, *prev = NULL;
+    int count;
+
+    if (!lst) return 0;
+
+    pthread_mutex_lock(&lst->lock);
+    if (pos <= 0 || pos > atomic_load_explicit(&lst->size, memory_order_relaxed)) {
+        pthread_mutex_unlock(&lst->lock);
+        return 0;
+    }
+
+    ptr = atomic_load_explicit(&lst->first, memory_order_relaxed);
+    for (count = 1; count < pos; count++) {
+        prev = ptr;
+        ptr = atomic_load_explicit(&ptr->next, memory_order_relaxed);
+    }
+    if (value) *value = ptr->value;
+    unlinkrculst(lst, prev, ptr);
+    pthread_mutex_unlock(&lst->lock);
+    return 1;
+}
@@ -0,0 +1,233 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef RCULINKEDLIST_H
+#define RCULINKEDLIST_H
+
+#include <stdatomic.h>
+#include <pthread.h>
+
+/**
+ * Número máximo de leitores registrados simultaneamente.
+ */
+#define RCULST_MAXREADERS 64
+
+/**
+ * Quantidade de nós removidos acumulados antes de iniciar um
+ * período de carência. O lote é liberado por uma remoção
+ * posterior, sem espera, quando o período termina, ou por
+ * synchronizerculst.
+ */
+#define RCULST_BATCH 128
+
+/**
+ * Estruturas de dados
+ *
+ * Lista encadeada para leitura predominante no estilo RCU.
+ * Leitores percorrem a lista sem travas nem operações atômicas
+ * de leitura-modificação-escrita; escritores são serializados
+ * por uma trava e publicam alterações com stores de liberação.
+ * Nós removidos são liberados após um período de carência
+ * detectado por estados quiescentes (QSBR).
+ */
+
+typedef struct rcunode {
+    int value;
+    struct rcunode *_Atomic next;
+    struct rcunode *retired;
+} NodeRculist;
+
+typedef struct {
+    _Alignas(64) _Atomic unsigned long seen;
+    _Atomic int used;
+} ReaderRculist;
+
+typedef struct {
+    NodeRculist *_Atomic first;
+    NodeRculist *last;
+    _Atomic int size;
+    pthread_mutex_t lock;
+    NodeRculist *retired, *waiting;
+    int nretired;
+    unsigned long waitgp;
+    _Atomic unsigned long gp;
+    ReaderRculist reader[RCULST_MAXREADERS];
+} Rculist;
+
+/**
+ * Cria cabeça de lista.
+ *
+ * @return Rculist* pointer para lista criada, ou NULL caso falhe.
+ */
+Rculist *createrculst();
+
+/**
+ * Destroi lista.
+ *
+ * Não deve ser chamada com leitores ou escritores ativos.
+ *
+ * @param lst ponteiro Rculist da lista.
+ */
+void destroyrculst(Rculist *lst);
+
+/**
+ * Registra thread leitora.
+ *
+ * O leitor começa online e deve chamar quiescentrculst
+ * periodicamente, fora de qualquer percurso da lista.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @return int identificador do leitor, ou -1 caso não haja vagas.
+ */
+int registerrculst(Rculist *lst);
+
+/**
+ * Cancela registro de thread leitora.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param rid identificador retornado por registerrculst.
+ */
+void unregisterrculst(Rculist *lst, int rid);
+
+/**
+ * Informa estado quiescente.
+ *
+ * Indica que o leitor não guarda referências a nós da lista.
+ * Ponteiros obtidos com findrculst deixam de ser válidos.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param rid identificador do leitor.
+ */
+void quiescentrculst(Rculist *lst, int rid);
+
+/**
+ * Coloca leitor offline.
+ *
+ * Um leitor offline não atrasa períodos de carência e não pode
+ * ler a lista até chamar onlinerculst.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param rid identificador do leitor.
+ */
+void offlinerculst(Rculist *lst, int rid);
+
+/**
+ * Coloca leitor online novamente.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param rid identificador do leitor.
+ */
+void onlinerculst(Rculist *lst, int rid);
+
+/**
+ * Aguarda período de carência e libera nós removidos.
+ *
+ * Bloqueia até que todos os leitores online tenham passado por
+ * um estado quiescente. Não deve ser chamada por um leitor online:
+ * um leitor que também escreve deve chamar offlinerculst antes.
+ *
+ * @param lst ponteiro Rculist da lista.
+ */
+void synchronizerculst(Rculist *lst);
+
+/**
+ * Verifica posição de informação (leitor).
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param value valor inteiro a ser buscado.
+ * @return int Número positivo indicando qual posição do valor.
+ *             -1 caso não seja encontrado.
+ */
+int positionrculst(Rculist *lst, int value);
+
+/**
+ * Verifica presença de informação na lista (leitor).
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param value valor inteiro a ser buscado.
+ * @return int 1 caso exista na lista, 0 caso contrário.
+ */
+int isinrculst(Rculist *lst, int value);
+
+/**
+ * Encontra informação na lista (leitor).
+ *
+ * O nó retornado só é válido até o próximo estado quiescente
+ * do leitor.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param value valor inteiro a ser buscado.
+ * @return NodeRculist* pointer para nó encontrado, ou NULL caso não exista.
+ */
+NodeRculist *findrculst(Rculist *lst, int value);
+
+/**
+ * Ver tamanho da lista.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @return int Número indicando tamanho da lista. -1 caso lista não exista.
+ */
+int lenrculst(Rculist *lst);
+
+/**
+ * Imprime elementos de lista (leitor).
+ *
+ * @param lst ponteiro Rculist da lista.
+ */
+void printrculst(Rculist *lst);
+
+/**
+ * Insere valor no inicio da lista (escritor).
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param value valor inteiro a ser gravado em nó.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertfirstrculst(Rculist *lst, int value);
+
+/**
+ * Insere valor no fim da lista (escritor).
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param value valor inteiro a ser gravado em nó.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertlastrculst(Rculist *lst, int value);
+
+/**
+ * Remove elemento da lista a partir do valor armazenado (escritor).
+ *
+ * Bloqueia apenas na trava de escrita e nunca aguarda leitores,
+ * podendo ser chamada por um leitor online. Nós removidos só são
+ * liberados depois que todos os leitores online passarem por um
+ * estado quiescente; enquanto algum leitor não o fizer, a memória
+ * retida cresce até synchronizerculst ser chamada.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param value valor inteiro a ser removido.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int delinforculst(Rculist *lst, int value);
+
+/**
+ * Remove elemento em uma posição da lista (escritor).
+ *
+ * Bloqueia apenas na trava de escrita e nunca aguarda leitores,
+ * podendo ser chamada por um leitor online. Nós removidos só são
+ * liberados depois que todos os leitores online passarem por um
+ * estado quiescente; enquanto algum leitor não o fizer, a memória
+ * retida cresce até synchronizerculst ser chamada.
+ *
+ * @param lst ponteiro Rculist da lista.
+ * @param pos inteiro com posição a ser removida (iniciando em 1).
+ * @param value ponteiro onde gravar o valor removido (pode ser NULL).
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int delpositionrculst(Rculist *lst, int pos, int *value);
+
+#endif
@@ -0,0 +1,88 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include <pthread.h>
+#include "rculinkedlist.h"
+
+#define NREADERS 3
+#define ROUNDS 20000
+
+Rculist *shared;
+_Atomic int stop;
+
+// Leitores procuram os valores fixos enquanto o escritor
+// insere e remove valores temporários.
+void *reader(void *arg) {
+    int rid = registerrculst(shared);
+    long errors = 0;
+
+    (void) arg;
+    while (!atomic_load(&stop)) {
+        if (!isinrculst(shared, 1) || !isinrculst(shared, 3)) errors++;
+        if (positionrculst(shared, 3) < 1) errors++;
+        quiescentrculst(shared, rid);
+    }
+    unregisterrculst(shared, rid);
+    return (void *) errors;
+}
+
+// dummy test
+int main() {
+    pthread_t threads[NREADERS];
+    void *errors;
+    long total = 0;
+    int i, rid, value;
+
+    shared = createrculst();
+
+    // Adiciona 3 elementos iniciais.
+    // Output: [ (1) (2) (3) ]
+    insertlastrculst(shared, 2);
+    insertlastrculst(shared, 3);
+    insertfirstrculst(shared, 1);
+    printrculst(shared);
+
+    // Remove elemento na segunda posição.
+    // Output: [ (1) (3) ]
+    delpositionrculst(shared, 2, &value);
+    printrculst(shared);
+
+    // Escritor ativo com leitores concorrentes.
+    for (i = 0; i < NREADERS; i++) pthread_create(&threads[i], NULL, reader, NULL);
+    for (i = 0; i < ROUNDS; i++) {
+        insertfirstrculst(shared, 100 + i % 7);
+        insertlastrculst(shared, 200 + i % 5);
+        delinforculst(shared, 100 + i % 7);
+        delinforculst(shared, 200 + i % 5);
+    }
+    atomic_store(&stop, 1);
+    for (i = 0; i < NREADERS; i++) {
+        pthread_join(threads[i], &errors);
+        total += (long) errors;
+    }
+    synchronizerculst(shared);
+
+    // Leitor que também escreve: as remoções nunca aguardam
+    // leitores, então não esperam pela própria thread.
+    rid = registerrculst(shared);
+    for (i = 0; i < 4 * RCULST_BATCH; i++) {
+        insertlastrculst(shared, 300 + i);
+        delinforculst(shared, 300 + i);
+        if (i % 64 == 0) quiescentrculst(shared, rid);
+    }
+    unregisterrculst(shared, rid);
+    synchronizerculst(shared);
+
+    // Output: [ (1) (3) ], erros: 0
+    printrculst(shared);
+    printf("erros: %ld\n", total);
+
+    destroyrculst(shared);
+    return total != 0;
+}
@@ -0,0 +1,100 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "parlinkedlist.h"
+
+// Compilar com:
+//   gcc -O2 bench_parallel.c parlinkedlist.c linkedlist.c ../../threadpool/threadpool.c -pthread
+//
+// Uso: ./a.out [n]  (padrão: 10000000 elementos)
+
+double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+long long value(InfoList *info, void *arg) {
+    (void) arg;
+    return info->value;
+}
+
+long long iseven(InfoList *info, void *arg) {
+    (void) arg;
+    return info->value % 2 == 0;
+}
+
+long long sum(long long a, long long b) {
+    return a + b;
+}
+
+long long max(long long a, long long b) {
+    return a > b ? a : b;
+}
+
+void scale(InfoList *info, void *arg) {
+    info->value *= *(int *) arg;
+}
+
+int main(int argc, char **argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 10000000;
+    int ncpu = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    long long s, c, m, s1 = 0;
+    double t0, tsplit, tred, tfor, tbase = 0;
+    int i, nthreads, one = 1;
+    ThreadPool *pool;
+    SplitList *split;
+    List *lst;
+
+    lst = createlst();
+    srand(42);
+    for (i = 0; i < n; i++) insertlastlst(lst, lstinfo(rand() % 1000));
+
+    printf("n = %d\n", n);
+    printf("%8s %10s %14s %14s %8s\n", "threads", "split s", "soma+cont+max", "foreach s", "speedup");
+
+    if (ncpu < 1) ncpu = 1;
+    for (nthreads = 1; ; nthreads = nthreads * 2 < ncpu ? nthreads * 2 : ncpu) {
+        pool = createpool(nthreads);
+
+        t0 = now();
+        split = createsplitlst(lst, nthreads * 4);
+        tsplit = now() - t0;
+
+        t0 = now();
+        s = reduceparlst(pool, split, value, sum, 0, NULL);
+        c = reduceparlst(pool, split, iseven, sum, 0, NULL);
+        m = reduceparlst(pool, split, value, max, -1, NULL);
+        tred = now() - t0;
+
+        t0 = now();
+        foreachparlst(pool, split, scale, &one);
+        tfor = now() - t0;
+
+        if (nthreads == 1) {
+            tbase = tred;
+            s1 = s;
+        }
+        if (s != s1) printf("soma divergente!\n");
+        printf("%8d %10.4f %14.4f %14.4f %7.2fx   (%lld, %lld, %lld)\n",
+               nthreads, tsplit, tred, tfor, tbase / tred, s, c, m);
+
+        destroysplitlst(split);
+        destroypool(pool);
+        if (nthreads == ncpu) break;
+    }
+
+    destroylst(lst);
+    return 0;
+}
@@ -0,0 +1,106 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linkedlist.h"
+
+// Compilar com:
+//   gcc -O2 bench_prefetch.c linkedlist.c
+//
+// Uso: ./a.out [n]  (padrão: 4000000 nós, bem acima do LLC)
+
+#define ROUNDS 5
+
+double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+void shuffle(void **v, int n) {
+    void *tmp;
+    int i, j;
+
+    for (i = n - 1; i > 0; i--) {
+        j = rand() % (i + 1);
+        tmp = v[i]; v[i] = v[j]; v[j] = tmp;
+    }
+}
+
+// Lista com nós e informações espalhados pelo heap: a ordem de
+// percurso não segue a ordem de alocação.
+List *scattered(int n) {
+    List *lst = createlst();
+    void **nodes = (void **) malloc(n * sizeof(void *));
+    void **infos = (void **) malloc(n * sizeof(void *));
+    NodeList *ptr;
+    int i;
+
+    for (i = 0; i < n; i++) insertlastlst(lst, lstinfo(i));
+    for (i = 0, ptr = lst->first; ptr; ptr = ptr->next, i++) {
+        nodes[i] = ptr;
+        infos[i] = ptr->info;
+    }
+
+    srand(42);
+    shuffle(nodes, n);
+    shuffle(infos, n);
+    for (i = 0; i < n; i++) {
+        ptr = (NodeList *) nodes[i];
+        ptr->info = (InfoList *) infos[i];
+        ptr->next = i < n - 1 ? (NodeList *) nodes[i + 1] : NULL;
+    }
+    lst->first = (NodeList *) nodes[0];
+    lst->last = (NodeList *) nodes[n - 1];
+
+    free(infos);
+    free(nodes);
+    return lst;
+}
+
+int main(int argc, char **argv) {
+    int dists[] = { 1, 2, 4, 8, 16, 32 };
+    int n = argc > 1 ? atoi(argv[1]) : 4000000;
+    InfoList missing = { -1 };
+    double t0, tbase, t;
+    int r, d, found = 0;
+    List *lst;
+
+    lst = scattered(n);
+
+    // Valor ausente: todas as buscas percorrem a lista inteira.
+    t0 = now();
+    for (r = 0; r < ROUNDS; r++) found += isinlst(lst, &missing);
+    tbase = (now() - t0) / ROUNDS;
+
+    printf("n = %d\n", n);
+    printf("%12s %12s %8s\n", "kernel", "tempo s", "speedup");
+    printf("%12s %12.4f %8.2f\n", "isinlst", tbase, 1.0);
+
+    for (d = 0; d < 6; d++) {
+        t0 = now();
+        for (r = 0; r < ROUNDS; r++) found += isinpflst(lst, &missing, dists[d]);
+        t = (now() - t0) / ROUNDS;
+        printf("%9s %2d %12.4f %8.2f\n", "dist", dists[d], t, tbase / t);
+    }
+
+    // Referência: mesma busca depois de reorganizar os nós.
+    relayoutlst(lst);
+    t0 = now();
+    for (r = 0; r < ROUNDS; r++) found += isinlst(lst, &missing);
+    t = (now() - t0) / ROUNDS;
+    printf("%12s %12.4f %8.2f\n", "relayoutlst", t, tbase / t);
+
+    if (found) printf("resultado divergente!\n");
+    destroylst(lst);
+    return 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linkedlist.h"
+
+// Compilar com:
+//   gcc -O2 bench_relayout.c linkedlist.c
+
+#define ROUNDS 10
+
+double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+// Lista com nós espalhados: os nós são alocados em sequência
+// e religados em ordem aleatória, como acontece após muitas
+// inserções e remoções.
+List *fragmented(int n) {
+    List *lst = createlst();
+    NodeList **nodes = (NodeList **) malloc(n * sizeof(NodeList *));
+    NodeList *ptr, *tmp;
+    int i, j;
+
+    for (i = 0; i < n; i++) insertlastlst(lst, lstinfo(i));
+    for (i = 0, ptr = lst->first; ptr; ptr = ptr->next) nodes[i++] = ptr;
+
+    srand(42);
+    for (i = n - 1; i > 0; i--) {
+        j = rand() % (i + 1);
+        tmp = nodes[i]; nodes[i] = nodes[j]; nodes[j] = tmp;
+    }
+    for (i = 0; i < n - 1; i++) nodes[i]->next = nodes[i + 1];
+    nodes[n - 1]->next = NULL;
+    lst->first = nodes[0];
+    lst->last = nodes[n - 1];
+
+    free(nodes);
+    return lst;
+}
+
+// Tempo médio de um percurso somando os valores.
+double traverse(List *lst, long long *sum) {
+    NodeList *ptr;
+    double t0;
+    int r;
+
+    t0 = now();
+    for (r = 0; r < ROUNDS; r++) {
+        for (*sum = 0, ptr = lst->first; ptr; ptr = ptr->next) *sum += ptr->info->value;
+    }
+    return (now() - t0) / ROUNDS;
+}
+
+int main() {
+    int sizes[] = { 10000, 100000, 1000000, 4000000 };
+    long long before, after;
+    double tfrag, trel, tpass;
+    List *lst;
+    int s;
+
+    printf("%9s %14s %14s %14s %8s\n", "n", "fragment. s", "relayoutlst s", "contiguous s", "speedup");
+
+    for (s = 0; s < 4; s++) {
+        lst = fragmented(sizes[s]);
+        tfrag = traverse(lst, &before);
+
+        tpass = now();
+        relayoutlst(lst);
+        tpass = now() - tpass;
+
+        trel = traverse(lst, &after);
+        if (before != after) printf("soma divergente!\n");
+
+        printf("%9d %14.6f %14.6f %14.6f %7.1fx\n", sizes[s], tfrag, tpass, trel, tfrag / trel);
+        destroylst(lst);
+    }
+    return 0;
+}
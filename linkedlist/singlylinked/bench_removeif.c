@@ -0,0 +1,92 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linkedlist.h"
+
+// Compilar com:
+//   gcc -O2 bench_removeif.c linkedlist.c
+
+double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+// Lista com os valores 0..n-1 embaralhados.
+List *build(int n) {
+    List *lst = createlst();
+    int *vals = (int *) malloc(n * sizeof(int));
+    int i, j, tmp;
+
+    for (i = 0; i < n; i++) vals[i] = i;
+    srand(42);
+    for (i = n - 1; i > 0; i--) {
+        j = rand() % (i + 1);
+        tmp = vals[i]; vals[i] = vals[j]; vals[j] = tmp;
+    }
+    for (i = 0; i < n; i++) insertlastlst(lst, lstinfo(vals[i]));
+    free(vals);
+    return lst;
+}
+
+int expired(InfoList *info, void *arg) {
+    return info->value < *(int *) arg;
+}
+
+int main() {
+    int sizes[] = { 1000, 10000, 40000 };
+    int percents[] = { 10, 50 };
+    int s, p, n, limit, count, i;
+    double t0, trep, tfun, tmac;
+    InfoList *victims;
+    NodeList *ptr;
+    List *lst;
+
+    printf("%8s %6s %14s %14s %14s\n", "n", "% rem", "delinfolst s", "removeiflst s", "REMOVEIFLST s");
+
+    for (s = 0; s < 3; s++) {
+        for (p = 0; p < 2; p++) {
+            n = sizes[s];
+            limit = n * percents[p] / 100;
+
+            // Uma chamada de delinfolst por vítima.
+            lst = build(n);
+            victims = (InfoList *) malloc(n * sizeof(InfoList));
+            t0 = now();
+            for (count = 0, ptr = lst->first; ptr; ptr = ptr->next) {
+                if (ptr->info->value < limit) victims[count++] = *ptr->info;
+            }
+            for (i = 0; i < count; i++) free(delinfolst(lst, &victims[i]));
+            trep = now() - t0;
+            free(victims);
+            destroylst(lst);
+
+            // Predicado por ponteiro de função.
+            lst = build(n);
+            t0 = now();
+            removeiflst(lst, expired, &limit, NULL);
+            tfun = now() - t0;
+            destroylst(lst);
+
+            // Condição expandida no laço.
+            lst = build(n);
+            t0 = now();
+            REMOVEIFLST(lst, info, info->value < limit, NULL, count);
+            tmac = now() - t0;
+            destroylst(lst);
+
+            printf("%8d %6d %14.6f %14.6f %14.6f\n", n, percents[p], trep, tfun, tmac);
+        }
+    }
+    return 0;
+}
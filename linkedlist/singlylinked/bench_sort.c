@@ -0,0 +1,82 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "parlinkedlist.h"
+
+// Compilar com:
+//   gcc -O2 bench_sort.c parlinkedlist.c linkedlist.c ../../threadpool/threadpool.c -pthread
+//
+// Uso: ./a.out [n]  (padrão: 5000000 elementos)
+
+double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+List *randomlst(int n) {
+    List *lst = createlst();
+    int i;
+
+    srand(42);
+    for (i = 0; i < n; i++) insertlastlst(lst, lstinfo(rand()));
+    return lst;
+}
+
+int issortedlst(List *lst) {
+    NodeList *ptr;
+    int count = 1;
+
+    if (isemptylst(lst)) return 1;
+    for (ptr = lst->first; ptr->next; ptr = ptr->next, count++) {
+        if (ptr->next->info->value < ptr->info->value) return 0;
+    }
+    return count == lst->size && ptr == lst->last;
+}
+
+int main(int argc, char **argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 5000000;
+    int ncpu = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    int counts[] = { 1, 2, 4, 8 };
+    int i, nthreads;
+    double t0, tseq;
+    ThreadPool *pool;
+    List *lst;
+
+    if (ncpu < 1) ncpu = 1;
+
+    lst = randomlst(n);
+    t0 = now();
+    mergesortlst(lst);
+    tseq = now() - t0;
+    printf("n = %d\n", n);
+    printf("mergesortlst: %.3f s%s\n", tseq, issortedlst(lst) ? "" : " (fora de ordem!)");
+    destroylst(lst);
+
+    printf("%8s %12s %8s\n", "threads", "sortparlst s", "speedup");
+    for (i = 0; i <= 4; i++) {
+        nthreads = i < 4 ? counts[i] : ncpu;
+        if (i < 4 && nthreads >= ncpu) continue;
+
+        lst = randomlst(n);
+        pool = createpool(nthreads);
+        t0 = now();
+        sortparlst(pool, lst);
+        t0 = now() - t0;
+        printf("%8d %12.3f %7.2fx%s\n", nthreads, t0, tseq / t0, issortedlst(lst) ? "" : " (fora de ordem!)");
+        destroypool(pool);
+        destroylst(lst);
+    }
+    return 0;
+}
@@ -9,6 +9,60 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "linkedlist.h"
+#include "../pfscan.h"
+
+/**
+ * Blocos de nós.
+ * 
+ * arraytolst aloca nós e informações em um único bloco, e
+ * relayoutlst move os nós para um bloco novo. Cada nó guarda o
+ * bloco a que pertence (NULL para nós alocados individualmente).
+ * Uma informação pertence ao bloco apenas se ocupa a posição do
+ * seu nó no vetor de informações; as demais foram alocadas pelo
+ * chamador e nunca são movidas. O bloco é liberado quando seu
+ * último nó é liberado.
+ */
+
+/**
+ * Verifica se a informação de um nó pertence ao seu bloco.
+ * 
+ * @param node ponteiro NodeList.
+ * @return int 1 caso a informação esteja no bloco do nó, 0 caso contrário.
+ */
+static int blockinfolst(NodeList *node) {
+    return node->block && node->info == &node->block->infos[node - node->block->nodes];
+}
+
+/**
+ * Aloca bloco de nós.
+ * 
+ * Aloca n nós e n informações em uma única chamada a malloc.
+ * Os nós já saem ligados em sequência, cada um apontando para
+ * a informação de mesma posição no bloco; cabe ao chamador
+ * gravar os valores, ou trocar a informação, e ligá-los à lista.
+ * 
+ * @param n quantidade de nós (maior que zero).
+ * @return NodeList* pointer para o primeiro nó, ou NULL caso falhe.
+ */
+static NodeList *blocklst(int n) {
+    BlockList *blk;
+    int i;
+
+    blk = (BlockList *) malloc(sizeof(BlockList) + n * (sizeof(NodeList) + sizeof(InfoList)));
+    if (!blk) return NULL;
+
+    blk->nodes = (NodeList *) (blk + 1);
+    blk->infos = (InfoList *) (blk->nodes + n);
+    blk->capacity = blk->live = n;
+
+    for (i = 0; i < n; i++) {
+        blk->nodes[i].info = &blk->infos[i];
+        blk->nodes[i].next = &blk->nodes[i + 1];
+        blk->nodes[i].block = blk;
+    }
+    blk->nodes[n - 1].next = NULL;
+    return blk->nodes;
+}
 
 /**
  * Cria cabeça de lista.
@@ -24,7 +78,7 @@ List *createlst() {
 
     if (ptr) {
         ptr->size = 0;
-        ptr->first = NULL;
+        ptr->first = ptr->last = NULL;
         return ptr;
     }
     return NULL;
@@ -45,11 +99,11 @@ void destroylst(List *lst) {
 
     while (lst->first) {
         ptr = lst->first->next;
-        free(lst->first->info);
-        free(lst->first);
+        freeinfolst(lst->first);
+        freenodelst(lst->first);
         lst->first = ptr;
     }
-    free(ptr);
+    free(lst);
 }
 
 /**
@@ -112,6 +166,21 @@ int isinlst(List *lst, InfoList *info) {
     return 0;
 }
 
+/**
+ * Verifica presença de informação na lista encadeada com prefetch.
+ * 
+ * Mesmo resultado de isinlst, usando o percurso
+ * antecipado de findpflst.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ * @param info ponteiro InfoList com informação a ser buscada.
+ * @param dist distância de prefetch em nós, ou <= 0 para PFSCAN_DIST.
+ * @return int 1 caso exista na lista encadeada, 0 caso contrário.
+ */
+int isinpflst(List *lst, InfoList *info, int dist) {
+    return findpflst(lst, info, dist) != NULL;
+}
+
 /** 
  * Encontra informação na lista.
  * 
@@ -134,6 +203,27 @@ InfoList *findlst(List *lst, InfoList *info) {
     return NULL;
 }
 
+/**
+ * Encontra informação na lista encadeada com prefetch.
+ * 
+ * Mesmo resultado de findlst, pedindo ao processador a informação
+ * de cada nó dist nós antes da comparação. Os nós continuam sendo
+ * lidos um a um; ver linkedlist/pfscan.h.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ * @param info ponteiro InfoList com informação a ser buscada.
+ * @param dist distância de prefetch em nós, ou <= 0 para PFSCAN_DIST.
+ * @return InfoList* pointer contendo nó encontrado, ou NULL caso não exista.
+ */
+InfoList *findpflst(List *lst, InfoList *info, int dist) {
+    if (isemptylst(lst)) return NULL;
+
+    PFSCAN(NodeList, ptr, lst->first, NEXTPFSCAN, dist,
+        if (ptr->info->value == info->value) return ptr->info;
+    );
+    return NULL;
+}
+
 /**
  * Ver tamanho da lista.
  * 
@@ -187,6 +277,7 @@ NodeList *lstnode() {
     if (ptr) {
         ptr->info = NULL;
         ptr->next = NULL;
+        ptr->block = NULL;
         return ptr;
     }
     return NULL;
@@ -212,6 +303,49 @@ InfoList *lstinfo(int i) {
     return NULL;
 }
 
+/**
+ * Libera nó.
+ * 
+ * Nós de bloco não são liberados um a um: cada liberação conta
+ * um nó vivo a menos e o bloco inteiro, com suas informações, é
+ * devolvido junto com o último deles.
+ * 
+ * @param node ponteiro NodeList já desligado da lista.
+ */
+void freenodelst(NodeList *node) {
+    if (!node->block) free(node);
+    else if (--node->block->live == 0) free(node->block);
+}
+
+/**
+ * Libera informação de nó.
+ * 
+ * Informações que pertencem ao bloco do nó não são liberadas
+ * individualmente. Deve ser chamada antes de freenodelst.
+ * 
+ * @param node ponteiro NodeList dono da informação.
+ */
+void freeinfolst(NodeList *node) {
+    if (!blockinfolst(node)) free(node->info);
+}
+
+/**
+ * Entrega informação de nó ao chamador.
+ * 
+ * Deve ser chamada antes de desligar o nó. Informações que
+ * pertencem ao bloco do nó (criadas por arraytolst) são copiadas
+ * para uma nova estrutura, de forma que o
+ * chamador sempre possa liberar o retorno com free; caso a cópia
+ * falhe, nada foi alterado e o nó pode continuar na lista.
+ * 
+ * @param node ponteiro NodeList a ser removido.
+ * @return InfoList* pointer que pertence ao chamador, ou NULL caso falhe.
+ */
+InfoList *takeinfolst(NodeList *node) {
+    if (!blockinfolst(node)) return node->info;
+    return lstinfo(node->info->value);
+}
+
 /**
  * Insere nó no inicio da lista.
  * 
@@ -228,6 +362,7 @@ int insertfirstlst(List *lst, InfoList *info) {
     ptr->info = info;
     ptr->next = lst->first;
     lst->first = ptr;
+    if (lst->last == NULL) lst->last = ptr;
     lst->size++;
     return 1;
 }
@@ -235,12 +370,14 @@ int insertfirstlst(List *lst, InfoList *info) {
 /**
  * Insere nó no fim da lista.
  * 
+ * Usa o ponteiro last da cabeça da lista, sem percorrê-la.
+ * 
  * @param lst ponteiro List da lista encadeada.
  * @param info ponteiro InfoList com informação a ser gravado em nó.
  * @return int 1 para sucesso, 0 caso contrário.
  */
 int insertlastlst(List *lst, InfoList *info) {
-    NodeList *ptr, *aux;
+    NodeList *ptr;
     ptr = lstnode();
 
     if (!lst || !ptr) return 0;
@@ -248,11 +385,8 @@ int insertlastlst(List *lst, InfoList *info) {
     ptr->info = info;
 
     if (lst->first == NULL) lst->first = ptr;
-    else {
-        aux = lst->first;
-        while (aux->next != NULL) aux = aux->next;
-        aux->next = ptr;
-    }
+    else lst->last->next = ptr;
+    lst->last = ptr;
 
     lst->size++;
     return 1;
@@ -271,10 +405,13 @@ InfoList *delfirstlst(List *lst) {
     if (isemptylst(lst)) return NULL;
 
     ptr = lst->first;
+    info = takeinfolst(ptr);
+    if (!info) return NULL;
+
     lst->first = ptr->next;
-    info = ptr->info;
+    if (lst->first == NULL) lst->last = NULL;
 
-    free(ptr);
+    freenodelst(ptr);
     lst->size--;
 
     return info;
@@ -288,12 +425,14 @@ InfoList *delfirstlst(List *lst) {
  * @return InfoList* do elemento removido, ou NULL caso falhe.
  */
 InfoList *delinfolst(List *lst, InfoList *info) {
-    NodeList *ptr, *aptr;
+    NodeList *ptr, *aptr = NULL;
     InfoList *ainfo;
 
+    if (isemptylst(lst)) return NULL;
+
     ptr = lst->first;
 
-    while (ptr->info->value != ainfo->value) {
+    while (ptr->info->value != info->value) {
         if (ptr->next == NULL) return NULL;
         else {
             aptr = ptr;
@@ -301,11 +440,14 @@ InfoList *delinfolst(List *lst, InfoList *info) {
         }
     }
 
+    ainfo = takeinfolst(ptr);
+    if (!ainfo) return NULL;
+
     if (ptr == lst->first) lst->first = ptr->next;
     else aptr->next = ptr->next;
+    if (ptr == lst->last) lst->last = aptr;
 
-    ainfo = ptr->info;
-    free(ptr);
+    freenodelst(ptr);
     lst->size--;
     return ainfo;
 }
@@ -318,7 +460,7 @@ InfoList *delinfolst(List *lst, InfoList *info) {
  * @return InfoList* do elemento removido, ou NULL caso falhe.
  */
 InfoList *delpositionlst(List *lst, int pos) {
-    NodeList *aptr, *ptr;
+    NodeList *aptr = NULL, *ptr;
     InfoList *info;
     int count = 1;
 
@@ -327,19 +469,26 @@ InfoList *delpositionlst(List *lst, int pos) {
         return NULL;
     }
 
-    if (pos == 1) {
-        ptr = lst->first;
-        lst->first = ptr->next;
-    }
+    if (pos == 1) ptr = lst->first;
     else {
         aptr = lst->first;
         for (count = 1; count < pos-1; count++, aptr = aptr->next);
         ptr = aptr->next;
+    }
+
+    info = takeinfolst(ptr);
+    if (!info) return NULL;
+
+    if (pos == 1) {
+        lst->first = ptr->next;
+        if (lst->first == NULL) lst->last = NULL;
+    }
+    else {
         aptr->next = ptr->next;
+        if (ptr == lst->last) lst->last = aptr;
     }
 
-    info = ptr->info;
-    free(ptr);
+    freenodelst(ptr);
     lst->size--;
     return info;
 }
@@ -351,11 +500,13 @@ InfoList *delpositionlst(List *lst, int pos) {
  */
 void reverselst(List *lst) {
     NodeList *prev = NULL;
-    NodeList *current = lst->first;
+    NodeList *current;
     NodeList *next;
 
     if (isemptylst(lst)) return;
+    current = lst->first;
 
+    lst->last = current;
     while (current != NULL) {
         next = current->next;
         current->next = prev;
@@ -370,34 +521,104 @@ void reverselst(List *lst) {
  * Ordena lista.
  * 
  * Realiza ordenação da lista utilizando o algoritmo de
- * ordenação bubble sort.
+ * ordenação bubble sort. Troca os nós de lugar em vez das
+ * informações, de forma que cada nó mantém sua informação.
  * 
  * @param lst ponteiro List da lista encadeada.
  */
 void sortlst(List *lst) {
     int i, j, k;
-    InfoList *tempInfo;
+    NodeList **link;
     NodeList *current;
     NodeList *next;
 
-    k = lst->size;
     if (isemptylst(lst)) return;
+    k = lst->size;
 
     for (i = 0; i < (lst->size - 1); i++, k--) {
-        current = lst->first;
-        next = lst->first->next;
+        link = &lst->first;
         for (j = 1; j < k; j++) {
+            current = *link;
+            next = current->next;
             if (current->info->value > next->info->value) {
-                tempInfo = current->info;
-                current->info = next->info;
-                next->info = tempInfo;
+                current->next = next->next;
+                next->next = current;
+                *link = next;
+                if (lst->last == next) lst->last = current;
             }
-            current = current->next;
-            next = next->next;
+            link = &(*link)->next;
         }
     }
 }
 
+/**
+ * Intercala duas cadeias ordenadas.
+ * 
+ * Em empates o nó de a vem primeiro, o que torna a ordenação estável.
+ * 
+ * @param a ponteiro NodeList da primeira cadeia.
+ * @param b ponteiro NodeList da segunda cadeia.
+ * @return NodeList* pointer para o início da cadeia intercalada.
+ */
+static NodeList *mergechainlst(NodeList *a, NodeList *b) {
+    NodeList head, *tail = &head;
+
+    while (a && b) {
+        if (b->info->value < a->info->value) {
+            tail->next = b;
+            b = b->next;
+        }
+        else {
+            tail->next = a;
+            a = a->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = a ? a : b;
+    return head.next;
+}
+
+/**
+ * Ordena os n primeiros nós de uma cadeia.
+ * 
+ * @param head ponteiro para o início da cadeia; avança para o nó
+ *             seguinte aos n ordenados.
+ * @param n quantidade de nós a ordenar (maior que zero).
+ * @return NodeList* pointer para a cadeia ordenada, terminada em NULL.
+ */
+static NodeList *sortchainlst(NodeList **head, int n) {
+    NodeList *a, *b;
+
+    if (n == 1) {
+        a = *head;
+        *head = a->next;
+        a->next = NULL;
+        return a;
+    }
+    a = sortchainlst(head, n / 2);
+    b = sortchainlst(head, n - n / 2);
+    return mergechainlst(a, b);
+}
+
+/**
+ * Ordena lista com merge sort.
+ * 
+ * Ordenação estável em O(n log n) que religa os nós em vez de
+ * trocar informações. Não aloca memória.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ */
+void mergesortlst(List *lst) {
+    NodeList *ptr;
+
+    if (!lst || lst->size < 2) return;
+
+    ptr = lst->first;
+    lst->first = sortchainlst(&ptr, lst->size);
+    for (ptr = lst->first; ptr->next; ptr = ptr->next);
+    lst->last = ptr;
+}
+
 /**
  * Remove elemento na última posição da lista.
  *
@@ -405,27 +626,633 @@ void sortlst(List *lst) {
  * @return InfoList* pointer do elemento removido, ou NULL caso falhe.
  */
 InfoList *dellastlst(List *lst) {
-    NodeList *ptr, *aptr;
+    NodeList *ptr, *aptr = NULL;
     InfoList *info;
 
     if (isemptylst(lst)) return NULL;
 
     ptr = lst->first;
-
-    if (lst->size == 1) lst->first = ptr->next;
-    else {
+    while (ptr->next != NULL) {
         aptr = ptr;
         ptr = ptr->next;
+    }
 
-        while (ptr->next != NULL) {
-            aptr = ptr;
-            ptr = ptr->next;
-        }
-        aptr->next = ptr->next;
+    info = takeinfolst(ptr);
+    if (!info) return NULL;
+
+    if (aptr == NULL) lst->first = lst->last = NULL;
+    else {
+        aptr->next = NULL;
+        lst->last = aptr;
     }
-    info = ptr->info;
 
-    free(ptr);
+    freenodelst(ptr);
     lst->size--;
     return info;
+}
+
+/**
+ * Inicializa cursor.
+ * 
+ * Posiciona o cursor no primeiro elemento da lista. O cursor
+ * guarda o nó corrente e o anterior, permitindo inserções e
+ * remoções em O(1) na posição em que se encontra.
+ * 
+ * @param cur ponteiro CursorList a ser inicializado.
+ * @param lst ponteiro List da lista encadeada.
+ */
+void initcursorlst(CursorList *cur, List *lst) {
+    cur->lst = lst;
+    cur->prev = NULL;
+    cur->current = lst ? lst->first : NULL;
+    cur->index = 0;
+}
+
+/**
+ * Verifica se cursor passou do fim da lista.
+ * 
+ * @param cur ponteiro CursorList.
+ * @return int 1 caso não haja elemento corrente, 0 caso contrário.
+ */
+int endcursorlst(CursorList *cur) {
+    return (!cur || cur->current == NULL);
+}
+
+/**
+ * Avança cursor para o próximo elemento.
+ * 
+ * @param cur ponteiro CursorList.
+ * @return int 1 caso o cursor esteja em um elemento, 0 caso
+ *             tenha chegado ao fim da lista.
+ */
+int nextcursorlst(CursorList *cur) {
+    if (endcursorlst(cur)) return 0;
+
+    cur->prev = cur->current;
+    cur->current = cur->current->next;
+    cur->index++;
+    return cur->current != NULL;
+}
+
+/**
+ * Obtém informação do elemento corrente.
+ * 
+ * @param cur ponteiro CursorList.
+ * @return InfoList* pointer do elemento corrente, ou NULL no fim da lista.
+ */
+InfoList *getcursorlst(CursorList *cur) {
+    if (endcursorlst(cur)) return NULL;
+    return cur->current->info;
+}
+
+/**
+ * Insere nó após o elemento corrente.
+ * 
+ * O cursor permanece no mesmo elemento. Caso esteja no fim da
+ * lista, o nó é inserido como último elemento.
+ * 
+ * @param cur ponteiro CursorList.
+ * @param info ponteiro InfoList com informação a ser gravada em nó.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertaftercursorlst(CursorList *cur, InfoList *info) {
+    NodeList *ptr;
+
+    if (!cur || !cur->lst) return 0;
+    if (endcursorlst(cur)) return insertbeforecursorlst(cur, info);
+
+    ptr = lstnode();
+    if (!ptr) return 0;
+
+    ptr->info = info;
+    ptr->next = cur->current->next;
+    cur->current->next = ptr;
+    if (cur->lst->last == cur->current) cur->lst->last = ptr;
+    cur->lst->size++;
+    return 1;
+}
+
+/**
+ * Insere nó antes do elemento corrente.
+ * 
+ * O novo nó passa a ser o anterior do cursor, que permanece no
+ * mesmo elemento.
+ * 
+ * @param cur ponteiro CursorList.
+ * @param info ponteiro InfoList com informação a ser gravada em nó.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertbeforecursorlst(CursorList *cur, InfoList *info) {
+    NodeList *ptr;
+
+    if (!cur || !cur->lst) return 0;
+    ptr = lstnode();
+    if (!ptr) return 0;
+
+    ptr->info = info;
+    ptr->next = cur->current;
+    if (cur->prev == NULL) cur->lst->first = ptr;
+    else cur->prev->next = ptr;
+    if (cur->current == NULL) cur->lst->last = ptr;
+    cur->prev = ptr;
+    cur->index++;
+    cur->lst->size++;
+    return 1;
+}
+
+/**
+ * Remove elemento corrente.
+ * 
+ * O cursor passa para o elemento seguinte ao removido.
+ * 
+ * @param cur ponteiro CursorList.
+ * @return InfoList* do elemento removido, ou NULL caso falhe.
+ */
+InfoList *delcursorlst(CursorList *cur) {
+    NodeList *ptr;
+    InfoList *info;
+
+    if (endcursorlst(cur)) return NULL;
+
+    ptr = cur->current;
+    info = takeinfolst(ptr);
+    if (!info) return NULL;
+
+    if (cur->prev == NULL) cur->lst->first = ptr->next;
+    else cur->prev->next = ptr->next;
+    if (cur->lst->last == ptr) cur->lst->last = cur->prev;
+    cur->current = ptr->next;
+
+    freenodelst(ptr);
+    cur->lst->size--;
+    return info;
+}
+
+/**
+ * Concatena listas.
+ * 
+ * Move todos os elementos de src para o fim de dst em O(1),
+ * sem percorrer nenhuma das listas. A lista src fica vazia,
+ * mas não é destruída.
+ * 
+ * @param dst ponteiro List da lista de destino.
+ * @param src ponteiro List da lista a ser anexada.
+ */
+void concatlst(List *dst, List *src) {
+    if (!dst || !src || dst == src || isemptylst(src)) return;
+
+    if (dst->first == NULL) dst->first = src->first;
+    else dst->last->next = src->first;
+    dst->last = src->last;
+    dst->size += src->size;
+
+    src->first = src->last = NULL;
+    src->size = 0;
+}
+
+/**
+ * Insere lista na posição do cursor.
+ * 
+ * Move todos os elementos de src para antes do elemento
+ * corrente em O(1). O cursor permanece no mesmo elemento e a
+ * lista src fica vazia, mas não é destruída.
+ * 
+ * @param cur ponteiro CursorList.
+ * @param src ponteiro List da lista a ser inserida.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int splicecursorlst(CursorList *cur, List *src) {
+    if (!cur || !cur->lst || !src || src == cur->lst) return 0;
+    if (isemptylst(src)) return 1;
+
+    src->last->next = cur->current;
+    if (cur->prev == NULL) cur->lst->first = src->first;
+    else cur->prev->next = src->first;
+    if (cur->current == NULL) cur->lst->last = src->last;
+
+    cur->prev = src->last;
+    cur->index += src->size;
+    cur->lst->size += src->size;
+
+    src->first = src->last = NULL;
+    src->size = 0;
+    return 1;
+}
+
+/**
+ * Divide lista na posição do cursor.
+ * 
+ * Move o elemento corrente e todos os seguintes para uma nova
+ * lista em O(1); os tamanhos das duas listas são obtidos da
+ * posição do cursor, sem recontagem. O cursor passa para o fim
+ * da lista original.
+ * 
+ * @param cur ponteiro CursorList.
+ * @return List* pointer para nova lista, ou NULL caso falhe.
+ */
+List *splitcursorlst(CursorList *cur) {
+    List *ptr;
+
+    if (!cur || !cur->lst) return NULL;
+    ptr = createlst();
+    if (!ptr || cur->current == NULL) return ptr;
+
+    ptr->first = cur->current;
+    ptr->last = cur->lst->last;
+    ptr->size = cur->lst->size - cur->index;
+
+    if (cur->prev == NULL) cur->lst->first = NULL;
+    else cur->prev->next = NULL;
+    cur->lst->last = cur->prev;
+    cur->lst->size = cur->index;
+
+    cur->current = NULL;
+    return ptr;
+}
+
+/**
+ * Divide lista ao meio.
+ * 
+ * Mantém a primeira metade (arredondada para cima) em lst e
+ * devolve a segunda metade em uma nova lista. Percorre apenas
+ * metade da lista para encontrar o ponto de divisão.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ * @return List* pointer para lista com a segunda metade, ou NULL caso falhe.
+ */
+List *splithalflst(List *lst) {
+    CursorList cur;
+    int i;
+
+    if (!lst) return NULL;
+
+    initcursorlst(&cur, lst);
+    for (i = 0; i < (lst->size + 1) / 2; i++) nextcursorlst(&cur);
+    return splitcursorlst(&cur);
+}
+
+/**
+ * Remove elementos que satisfazem um predicado.
+ * 
+ * Percorre a lista uma única vez desligando todos os elementos
+ * para os quais pred retorna diferente de zero. Os elementos
+ * removidos são gravados em out, na ordem da lista, ou liberados
+ * caso out seja NULL. Com out, caso a cópia de uma informação
+ * alocada em bloco falhe, o elemento permanece na lista.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ * @param pred função que recebe a informação e arg.
+ * @param arg ponteiro repassado a pred.
+ * @param out vetor com espaço para lenlst(lst) ponteiros, ou NULL.
+ * @return int quantidade de elementos removidos, -1 caso falhe.
+ */
+int removeiflst(List *lst, int (*pred)(InfoList *, void *), void *arg, InfoList **out) {
+    int count;
+
+    if (!lst || !pred) return -1;
+
+    REMOVEIFLST(lst, info, pred(info, arg), out, count);
+    return count;
+}
+
+/**
+ * Conjunto de inteiros por endereçamento aberto.
+ * 
+ * Estrutura temporária usada pelas operações de conjunto,
+ * com sondagem linear e capacidade potência de dois.
+ */
+typedef struct {
+    int *keys;
+    unsigned char *full;
+    unsigned mask;
+} HashList;
+
+/**
+ * Inicializa conjunto com espaço para n chaves.
+ * 
+ * @param set ponteiro HashList a ser inicializado.
+ * @param n quantidade máxima de chaves.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+static int hashinitlst(HashList *set, int n) {
+    unsigned cap = 16;
+
+    while (cap < 2u * (unsigned) n) cap <<= 1;
+    set->keys = (int *) malloc(cap * (sizeof(int) + 1));
+    if (!set->keys) return 0;
+
+    set->full = (unsigned char *) (set->keys + cap);
+    set->mask = cap - 1;
+    for (; cap > 0; cap--) set->full[cap - 1] = 0;
+    return 1;
+}
+
+/**
+ * Calcula posição inicial de uma chave.
+ * 
+ * @param set ponteiro HashList.
+ * @param key chave inteira.
+ * @return unsigned índice inicial da sondagem.
+ */
+static unsigned hashslotlst(HashList *set, int key) {
+    unsigned h = (unsigned) key;
+
+    h ^= h >> 16;
+    h *= 0x45d9f3bu;
+    h ^= h >> 16;
+    return h & set->mask;
+}
+
+/**
+ * Adiciona chave ao conjunto.
+ * 
+ * @param set ponteiro HashList.
+ * @param key chave inteira.
+ * @return int 1 caso a chave seja nova, 0 caso já exista.
+ */
+static int hashaddlst(HashList *set, int key) {
+    unsigned i;
+
+    for (i = hashslotlst(set, key); set->full[i]; i = (i + 1) & set->mask) {
+        if (set->keys[i] == key) return 0;
+    }
+    set->full[i] = 1;
+    set->keys[i] = key;
+    return 1;
+}
+
+/**
+ * Verifica presença de chave no conjunto.
+ * 
+ * @param set ponteiro HashList.
+ * @param key chave inteira.
+ * @return int 1 caso exista, 0 caso contrário.
+ */
+static int hashhaslst(HashList *set, int key) {
+    unsigned i;
+
+    for (i = hashslotlst(set, key); set->full[i]; i = (i + 1) & set->mask) {
+        if (set->keys[i] == key) return 1;
+    }
+    return 0;
+}
+
+/**
+ * Verifica se lista está em ordem crescente.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ * @return int 1 caso ordenada, 0 caso contrário.
+ */
+static int issortedlst(List *lst) {
+    NodeList *ptr;
+
+    for (ptr = lst->first; ptr && ptr->next; ptr = ptr->next) {
+        if (ptr->info->value > ptr->next->info->value) return 0;
+    }
+    return 1;
+}
+
+/**
+ * Operação de conjunto genérica.
+ * 
+ * Quando as duas listas estão ordenadas, intercala-as em uma
+ * única passada; caso contrário, usa conjuntos hash temporários.
+ * 
+ * @param a ponteiro List do primeiro operando.
+ * @param b ponteiro List do segundo operando.
+ * @param op 0 união, 1 interseção, 2 diferença.
+ * @return List* pointer para lista resultado, ou NULL caso falhe.
+ */
+static List *setoplst(List *a, List *b, int op) {
+    HashList inb, seen;
+    NodeList *p, *q;
+    List *result;
+    int *vals, n = 0, v, ina, inbv;
+
+    if (!a || !b) return NULL;
+
+    vals = (int *) malloc((a->size + b->size + 1) * sizeof(int));
+    if (!vals) return NULL;
+
+    if (issortedlst(a) && issortedlst(b)) {
+        p = a->first;
+        q = b->first;
+        while (p || q) {
+            if (!q || (p && p->info->value < q->info->value)) v = p->info->value;
+            else v = q->info->value;
+
+            // Consome todas as repetições de v nas duas listas.
+            for (ina = 0; p && p->info->value == v; p = p->next) ina = 1;
+            for (inbv = 0; q && q->info->value == v; q = q->next) inbv = 1;
+
+            if (op == 0 || (op == 1 && ina && inbv) || (op == 2 && ina && !inbv)) vals[n++] = v;
+        }
+    }
+    else {
+        if (!hashinitlst(&seen, a->size + (op == 0 ? b->size : 0))) {
+            free(vals);
+            return NULL;
+        }
+        if (op == 0) {
+            for (p = a->first; p; p = p->next) {
+                if (hashaddlst(&seen, p->info->value)) vals[n++] = p->info->value;
+            }
+            for (q = b->first; q; q = q->next) {
+                if (hashaddlst(&seen, q->info->value)) vals[n++] = q->info->value;
+            }
+        }
+        else {
+            if (!hashinitlst(&inb, b->size)) {
+                free(seen.keys);
+                free(vals);
+                return NULL;
+            }
+            for (q = b->first; q; q = q->next) hashaddlst(&inb, q->info->value);
+            for (p = a->first; p; p = p->next) {
+                v = p->info->value;
+                if (hashhaslst(&inb, v) == (op == 1) && hashaddlst(&seen, v)) vals[n++] = v;
+            }
+            free(inb.keys);
+        }
+        free(seen.keys);
+    }
+
+    result = arraytolst(vals, n);
+    free(vals);
+    return result;
+}
+
+/**
+ * União de listas.
+ * 
+ * Cria nova lista com os valores distintos presentes em a ou b,
+ * em tempo linear. Se as duas listas estiverem ordenadas, o
+ * resultado também é ordenado; caso contrário, segue a ordem de
+ * primeira ocorrência em a e depois em b. Os nós do resultado são
+ * alocados em um único bloco.
+ * 
+ * @param a ponteiro List do primeiro operando.
+ * @param b ponteiro List do segundo operando.
+ * @return List* pointer para lista resultado, ou NULL caso falhe.
+ */
+List *unionlst(List *a, List *b) {
+    return setoplst(a, b, 0);
+}
+
+/**
+ * Interseção de listas.
+ * 
+ * Cria nova lista com os valores distintos presentes em a e em b,
+ * em tempo linear, na ordem em que aparecem em a. Os nós do
+ * resultado são alocados em um único bloco.
+ * 
+ * @param a ponteiro List do primeiro operando.
+ * @param b ponteiro List do segundo operando.
+ * @return List* pointer para lista resultado, ou NULL caso falhe.
+ */
+List *intersectlst(List *a, List *b) {
+    return setoplst(a, b, 1);
+}
+
+/**
+ * Diferença de listas.
+ * 
+ * Cria nova lista com os valores distintos presentes em a e
+ * ausentes em b, em tempo linear, na ordem em que aparecem em a.
+ * Os nós do resultado são alocados em um único bloco.
+ * 
+ * @param a ponteiro List do primeiro operando.
+ * @param b ponteiro List do segundo operando.
+ * @return List* pointer para lista resultado, ou NULL caso falhe.
+ */
+List *differencelst(List *a, List *b) {
+    return setoplst(a, b, 2);
+}
+
+/**
+ * Remove valores repetidos da lista.
+ * 
+ * Mantém a primeira ocorrência de cada valor. Listas ordenadas
+ * são tratadas comparando vizinhos; as demais usam um conjunto
+ * hash temporário. Executa em tempo linear.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ * @return int quantidade de elementos removidos, -1 caso falhe.
+ */
+int deduplst(List *lst) {
+    HashList seen;
+    NodeList *ptr, *next;
+    int count = 0;
+
+    if (!lst) return -1;
+
+    if (issortedlst(lst)) {
+        for (ptr = lst->first; ptr && ptr->next; ) {
+            next = ptr->next;
+            if (next->info->value != ptr->info->value) {
+                ptr = next;
+                continue;
+            }
+            ptr->next = next->next;
+            if (lst->last == next) lst->last = ptr;
+            freeinfolst(next);
+            freenodelst(next);
+            count++;
+        }
+        lst->size -= count;
+        return count;
+    }
+
+    if (!hashinitlst(&seen, lst->size)) return -1;
+    REMOVEIFLST(lst, info, !hashaddlst(&seen, info->value), NULL, count);
+    free(seen.keys);
+    return count;
+}
+
+/**
+ * Cria lista a partir de vetor.
+ * 
+ * Aloca todos os nós e informações em um único bloco e os liga
+ * em uma única passada, na ordem do vetor. Evita as n chamadas a
+ * lstinfo e insertlastlst. Elementos removidos depois são
+ * entregues como cópia (ver takeinfolst), e o bloco só é liberado
+ * quando seu último nó é removido.
+ * 
+ * @param arr vetor de inteiros.
+ * @param n quantidade de elementos do vetor.
+ * @return List* pointer para lista criada, ou NULL caso falhe.
+ */
+List *arraytolst(const int *arr, int n) {
+    List *lst;
+    NodeList *ptr;
+    int i;
+
+    if (!arr && n > 0) return NULL;
+    lst = createlst();
+    if (!lst || n <= 0) return lst;
+
+    lst->first = blocklst(n);
+    if (!lst->first) {
+        destroylst(lst);
+        return NULL;
+    }
+    for (i = 0, ptr = lst->first; i < n; i++, ptr = ptr->next) {
+        ptr->info->value = arr[i];
+        lst->last = ptr;
+    }
+    lst->size = n;
+    return lst;
+}
+
+/**
+ * Copia valores da lista para vetor.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ * @param arr vetor com espaço para lenlst(lst) inteiros.
+ * @return int quantidade de valores copiados, -1 caso falhe.
+ */
+int lsttoarray(List *lst, int *arr) {
+    NodeList *ptr;
+    int i;
+
+    if (!lst || (!arr && lst->size > 0)) return -1;
+
+    for (i = 0, ptr = lst->first; ptr; i++, ptr = ptr->next) arr[i] = ptr->info->value;
+    return i;
+}
+
+/**
+ * Reorganiza nós da lista em memória contígua.
+ * 
+ * Realoca todos os nós em um único bloco, na ordem de percurso,
+ * e libera os nós antigos. Depois de muitas inserções e remoções
+ * os nós ficam espalhados pelo heap; após a reorganização os
+ * percursos acessam a memória sequencialmente. Blocos antigos
+ * mantidos por poucos nós também são liberados. Informações
+ * alocadas pelo chamador não são movidas e seus ponteiros
+ * continuam válidos; apenas as que pertencem a um bloco (criadas
+ * por arraytolst) são copiadas para o bloco novo.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int relayoutlst(List *lst) {
+    NodeList *old, *next, *ptr;
+
+    if (!lst) return 0;
+    if (lst->size == 0) return 1;
+
+    ptr = blocklst(lst->size);
+    if (!ptr) return 0;
+
+    old = lst->first;
+    lst->first = ptr;
+    for (; old; old = next, ptr = ptr->next) {
+        next = old->next;
+        if (blockinfolst(old)) ptr->info->value = old->info->value;
+        else ptr->info = old->info;
+        lst->last = ptr;
+        freenodelst(old);
+    }
+    return 1;
 }
\ No newline at end of file
@@ -9,6 +9,8 @@
 #ifndef LINKEDLIST_H
 #define LINKEDLIST_H
 
+#include <stdlib.h>
+
 /**
  * Estruturas de dados
  */
@@ -20,13 +22,66 @@ typedef struct {
 typedef struct tnode {
     struct tnode *next;
     InfoList *info;
+    struct tblock *block;
 } NodeList;
 
+typedef struct tblock {
+    NodeList *nodes;
+    InfoList *infos;
+    int capacity, live;
+} BlockList;
+
 typedef struct {
     int size;
-    NodeList *first;
+    NodeList *first, *last;
 } List;
 
+typedef struct {
+    List *lst;
+    NodeList *prev, *current;
+    int index;
+} CursorList;
+
+/**
+ * Remove, em uma única passada, todos os elementos que
+ * satisfazem uma condição.
+ * 
+ * Versão em macro de removeiflst para laços críticos: a condição
+ * é expandida no próprio laço, sem chamada indireta. Dentro de
+ * cond, var é o InfoList* do elemento corrente. lst é avaliada
+ * várias vezes e deve ser uma lista válida. Com out, caso a cópia
+ * de uma informação alocada em bloco falhe, o elemento permanece
+ * na lista.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ * @param var nome da variável InfoList* usada em cond.
+ * @param cond expressão que decide se o elemento é removido.
+ * @param out vetor InfoList** que recebe os removidos, ou NULL
+ *            para liberá-los.
+ * @param count variável int que recebe a quantidade removida.
+ */
+#define REMOVEIFLST(lst, var, cond, out, count) do {                \
+    NodeList *rmprev_ = NULL, *rmptr_, *rmnext_;                    \
+    InfoList **rmout_ = (out), *rmtaken_;                           \
+    (count) = 0;                                                    \
+    for (rmptr_ = (lst)->first; rmptr_; rmptr_ = rmnext_) {         \
+        InfoList *var = rmptr_->info;                               \
+        rmnext_ = rmptr_->next;                                     \
+        rmtaken_ = NULL;                                            \
+        if ((cond) && (!rmout_ || (rmtaken_ = takeinfolst(rmptr_)))) { \
+            if (rmprev_) rmprev_->next = rmnext_;                   \
+            else (lst)->first = rmnext_;                            \
+            if (rmout_) rmout_[(count)] = rmtaken_;                 \
+            else freeinfolst(rmptr_);                               \
+            freenodelst(rmptr_);                                    \
+            (count)++;                                              \
+        }                                                           \
+        else rmprev_ = rmptr_;                                      \
+    }                                                               \
+    (lst)->last = rmprev_;                                          \
+    (lst)->size -= (count);                                         \
+} while (0)
+
 /**
  * Cria cabeça de lista.
  * 
@@ -81,6 +136,19 @@ int positionlst(List *lst, InfoList *info);
  */
 int isinlst(List *lst, InfoList *info);
 
+/**
+ * Verifica presença de informação na lista encadeada com prefetch.
+ * 
+ * Mesmo resultado de isinlst, usando o percurso
+ * antecipado de findpflst.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ * @param info ponteiro InfoList com informação a ser buscada.
+ * @param dist distância de prefetch em nós, ou <= 0 para PFSCAN_DIST.
+ * @return int 1 caso exista na lista encadeada, 0 caso contrário.
+ */
+int isinpflst(List *lst, InfoList *info, int dist);
+
 /** 
  * 
  * Encontra informação na lista.
@@ -95,6 +163,20 @@ int isinlst(List *lst, InfoList *info);
  */
 InfoList *findlst(List *lst, InfoList *info);
 
+/**
+ * Encontra informação na lista encadeada com prefetch.
+ * 
+ * Mesmo resultado de findlst, pedindo ao processador a informação
+ * de cada nó dist nós antes da comparação. Os nós continuam sendo
+ * lidos um a um; ver linkedlist/pfscan.h.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ * @param info ponteiro InfoList com informação a ser buscada.
+ * @param dist distância de prefetch em nós, ou <= 0 para PFSCAN_DIST.
+ * @return InfoList* pointer contendo nó encontrado, ou NULL caso não exista.
+ */
+InfoList *findpflst(List *lst, InfoList *info, int dist);
+
 /**
  * Ver tamanho da lista.
  * 
@@ -136,6 +218,41 @@ NodeList *lstnode();
  */
 InfoList *lstinfo(int i);
 
+/**
+ * Libera nó.
+ * 
+ * Nós de bloco não são liberados um a um: cada liberação conta
+ * um nó vivo a menos e o bloco inteiro, com suas informações, é
+ * devolvido junto com o último deles.
+ * 
+ * @param node ponteiro NodeList já desligado da lista.
+ */
+void freenodelst(NodeList *node);
+
+/**
+ * Libera informação de nó.
+ * 
+ * Informações que pertencem ao bloco do nó não são liberadas
+ * individualmente. Deve ser chamada antes de freenodelst.
+ * 
+ * @param node ponteiro NodeList dono da informação.
+ */
+void freeinfolst(NodeList *node);
+
+/**
+ * Entrega informação de nó ao chamador.
+ * 
+ * Deve ser chamada antes de desligar o nó. Informações que
+ * pertencem ao bloco do nó (criadas por arraytolst) são copiadas
+ * para uma nova estrutura, de forma que o
+ * chamador sempre possa liberar o retorno com free; caso a cópia
+ * falhe, nada foi alterado e o nó pode continuar na lista.
+ * 
+ * @param node ponteiro NodeList a ser removido.
+ * @return InfoList* pointer que pertence ao chamador, ou NULL caso falhe.
+ */
+InfoList *takeinfolst(NodeList *node);
+
 /**
  * Insere nó no inicio da lista.
  * 
@@ -148,6 +265,8 @@ int insertfirstlst(List *lst, InfoList *info);
 /**
  * Insere nó no fim da lista.
  * 
+ * Usa o ponteiro last da cabeça da lista, sem percorrê-la.
+ * 
  * @param lst ponteiro List da lista encadeada.
  * @param info ponteiro InfoList com informação a ser gravado em nó.
  * @return int 1 para sucesso, 0 caso contrário.
@@ -190,12 +309,23 @@ void reverselst(List *lst);
  * Ordena lista.
  * 
  * Realiza ordenação da lista utilizando o algoritmo de
- * ordenação bubble sort.
+ * ordenação bubble sort. Troca os nós de lugar em vez das
+ * informações, de forma que cada nó mantém sua informação.
  * 
  * @param lst ponteiro List da lista encadeada.
  */
 void sortlst(List *lst);
 
+/**
+ * Ordena lista com merge sort.
+ * 
+ * Ordenação estável em O(n log n) que religa os nós em vez de
+ * trocar informações. Não aloca memória.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ */
+void mergesortlst(List *lst);
+
 /**
  * Remove elemento na última posição da lista.
  *
@@ -204,4 +334,236 @@ void sortlst(List *lst);
  */
 InfoList *dellastlst(List *lst);
 
+/**
+ * Inicializa cursor.
+ * 
+ * Posiciona o cursor no primeiro elemento da lista. O cursor
+ * guarda o nó corrente e o anterior, permitindo inserções e
+ * remoções em O(1) na posição em que se encontra.
+ * 
+ * @param cur ponteiro CursorList a ser inicializado.
+ * @param lst ponteiro List da lista encadeada.
+ */
+void initcursorlst(CursorList *cur, List *lst);
+
+/**
+ * Verifica se cursor passou do fim da lista.
+ * 
+ * @param cur ponteiro CursorList.
+ * @return int 1 caso não haja elemento corrente, 0 caso contrário.
+ */
+int endcursorlst(CursorList *cur);
+
+/**
+ * Avança cursor para o próximo elemento.
+ * 
+ * @param cur ponteiro CursorList.
+ * @return int 1 caso o cursor esteja em um elemento, 0 caso
+ *             tenha chegado ao fim da lista.
+ */
+int nextcursorlst(CursorList *cur);
+
+/**
+ * Obtém informação do elemento corrente.
+ * 
+ * @param cur ponteiro CursorList.
+ * @return InfoList* pointer do elemento corrente, ou NULL no fim da lista.
+ */
+InfoList *getcursorlst(CursorList *cur);
+
+/**
+ * Insere nó após o elemento corrente.
+ * 
+ * O cursor permanece no mesmo elemento. Caso esteja no fim da
+ * lista, o nó é inserido como último elemento.
+ * 
+ * @param cur ponteiro CursorList.
+ * @param info ponteiro InfoList com informação a ser gravada em nó.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertaftercursorlst(CursorList *cur, InfoList *info);
+
+/**
+ * Insere nó antes do elemento corrente.
+ * 
+ * O novo nó passa a ser o anterior do cursor, que permanece no
+ * mesmo elemento.
+ * 
+ * @param cur ponteiro CursorList.
+ * @param info ponteiro InfoList com informação a ser gravada em nó.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int insertbeforecursorlst(CursorList *cur, InfoList *info);
+
+/**
+ * Remove elemento corrente.
+ * 
+ * O cursor passa para o elemento seguinte ao removido.
+ * 
+ * @param cur ponteiro CursorList.
+ * @return InfoList* do elemento removido, ou NULL caso falhe.
+ */
+InfoList *delcursorlst(CursorList *cur);
+
+/**
+ * Concatena listas.
+ * 
+ * Move todos os elementos de src para o fim de dst em O(1),
+ * sem percorrer nenhuma das listas. A lista src fica vazia,
+ * mas não é destruída.
+ * 
+ * @param dst ponteiro List da lista de destino.
+ * @param src ponteiro List da lista a ser anexada.
+ */
+void concatlst(List *dst, List *src);
+
+/**
+ * Insere lista na posição do cursor.
+ * 
+ * Move todos os elementos de src para antes do elemento
+ * corrente em O(1). O cursor permanece no mesmo elemento e a
+ * lista src fica vazia, mas não é destruída.
+ * 
+ * @param cur ponteiro CursorList.
+ * @param src ponteiro List da lista a ser inserida.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int splicecursorlst(CursorList *cur, List *src);
+
+/**
+ * Divide lista na posição do cursor.
+ * 
+ * Move o elemento corrente e todos os seguintes para uma nova
+ * lista em O(1); os tamanhos das duas listas são obtidos da
+ * posição do cursor, sem recontagem. O cursor passa para o fim
+ * da lista original.
+ * 
+ * @param cur ponteiro CursorList.
+ * @return List* pointer para nova lista, ou NULL caso falhe.
+ */
+List *splitcursorlst(CursorList *cur);
+
+/**
+ * Divide lista ao meio.
+ * 
+ * Mantém a primeira metade (arredondada para cima) em lst e
+ * devolve a segunda metade em uma nova lista. Percorre apenas
+ * metade da lista para encontrar o ponto de divisão.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ * @return List* pointer para lista com a segunda metade, ou NULL caso falhe.
+ */
+List *splithalflst(List *lst);
+
+/**
+ * Remove elementos que satisfazem um predicado.
+ * 
+ * Percorre a lista uma única vez desligando todos os elementos
+ * para os quais pred retorna diferente de zero. Os elementos
+ * removidos são gravados em out, na ordem da lista, ou liberados
+ * caso out seja NULL. Com out, caso a cópia de uma informação
+ * alocada em bloco falhe, o elemento permanece na lista.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ * @param pred função que recebe a informação e arg.
+ * @param arg ponteiro repassado a pred.
+ * @param out vetor com espaço para lenlst(lst) ponteiros, ou NULL.
+ * @return int quantidade de elementos removidos, -1 caso falhe.
+ */
+int removeiflst(List *lst, int (*pred)(InfoList *, void *), void *arg, InfoList **out);
+
+/**
+ * União de listas.
+ * 
+ * Cria nova lista com os valores distintos presentes em a ou b,
+ * em tempo linear. Se as duas listas estiverem ordenadas, o
+ * resultado também é ordenado; caso contrário, segue a ordem de
+ * primeira ocorrência em a e depois em b. Os nós do resultado são
+ * alocados em um único bloco.
+ * 
+ * @param a ponteiro List do primeiro operando.
+ * @param b ponteiro List do segundo operando.
+ * @return List* pointer para lista resultado, ou NULL caso falhe.
+ */
+List *unionlst(List *a, List *b);
+
+/**
+ * Interseção de listas.
+ * 
+ * Cria nova lista com os valores distintos presentes em a e em b,
+ * em tempo linear, na ordem em que aparecem em a. Os nós do
+ * resultado são alocados em um único bloco.
+ * 
+ * @param a ponteiro List do primeiro operando.
+ * @param b ponteiro List do segundo operando.
+ * @return List* pointer para lista resultado, ou NULL caso falhe.
+ */
+List *intersectlst(List *a, List *b);
+
+/**
+ * Diferença de listas.
+ * 
+ * Cria nova lista com os valores distintos presentes em a e
+ * ausentes em b, em tempo linear, na ordem em que aparecem em a.
+ * Os nós do resultado são alocados em um único bloco.
+ * 
+ * @param a ponteiro List do primeiro operando.
+ * @param b ponteiro List do segundo operando.
+ * @return List* pointer para lista resultado, ou NULL caso falhe.
+ */
+List *differencelst(List *a, List *b);
+
+/**
+ * Remove valores repetidos da lista.
+ * 
+ * Mantém a primeira ocorrência de cada valor. Listas ordenadas
+ * são tratadas comparando vizinhos; as demais usam um conjunto
+ * hash temporário. Executa em tempo linear.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ * @return int quantidade de elementos removidos, -1 caso falhe.
+ */
+int deduplst(List *lst);
+
+/**
+ * Cria lista a partir de vetor.
+ * 
+ * Aloca todos os nós e informações em um único bloco e os liga
+ * em uma única passada, na ordem do vetor. Evita as n chamadas a
+ * lstinfo e insertlastlst. Elementos removidos depois são
+ * entregues como cópia (ver takeinfolst), e o bloco só é liberado
+ * quando seu último nó é removido.
+ * 
+ * @param arr vetor de inteiros.
+ * @param n quantidade de elementos do vetor.
+ * @return List* pointer para lista criada, ou NULL caso falhe.
+ */
+List *arraytolst(const int *arr, int n);
+
+/**
+ * Copia valores da lista para vetor.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ * @param arr vetor com espaço para lenlst(lst) inteiros.
+ * @return int quantidade de valores copiados, -1 caso falhe.
+ */
+int lsttoarray(List *lst, int *arr);
+
+/**
+ * Reorganiza nós da lista em memória contígua.
+ * 
+ * Realoca todos os nós em um único bloco, na ordem de percurso,
+ * e libera os nós antigos. Depois de muitas inserções e remoções
+ * os nós ficam espalhados pelo heap; após a reorganização os
+ * percursos acessam a memória sequencialmente. Blocos antigos
+ * mantidos por poucos nós também são liberados. Informações
+ * alocadas pelo chamador não são movidas e seus ponteiros
+ * continuam válidos; apenas as que pertencem a um bloco (criadas
+ * por arraytolst) são copiadas para o bloco novo.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int relayoutlst(List *lst);
+
 #endif
\ No newline at end of file
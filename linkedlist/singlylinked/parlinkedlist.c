@@ -0,0 +1,285 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdlib.h>
+#include "parlinkedlist.h"
+#include "../../sorting/gensort.h"
+#include "../../sorting/genparallelsort.h"
+
+/**
+ * Tarefa de um segmento.
+ */
+typedef struct {
+    NodeList *start;
+    int count;
+    void (*fn)(InfoList *, void *);
+    long long (*map)(InfoList *, void *);
+    long long (*combine)(long long, long long);
+    long long result;
+    void *arg;
+} JobParList;
+
+/**
+ * Executa tarefa de segmento.
+ * 
+ * @param arg ponteiro JobParList da tarefa.
+ */
+static void runjobparlst(void *arg) {
+    JobParList *job = (JobParList *) arg;
+    NodeList *ptr = job->start;
+    long long acc = job->result;
+    int i;
+
+    if (job->fn) {
+        for (i = 0; i < job->count; i++, ptr = ptr->next) job->fn(ptr->info, job->arg);
+        return;
+    }
+    for (i = 0; i < job->count; i++, ptr = ptr->next) acc = job->combine(acc, job->map(ptr->info, job->arg));
+    job->result = acc;
+}
+
+/**
+ * Executa uma tarefa por segmento.
+ * 
+ * @param pool ponteiro ThreadPool que executa as tarefas, ou NULL.
+ * @param split ponteiro SplitList com os segmentos da lista.
+ * @param jobs vetor com uma tarefa por segmento.
+ */
+static void runjobsparlst(ThreadPool *pool, SplitList *split, JobParList *jobs) {
+    int i;
+
+    for (i = 0; i < split->nseg; i++) {
+        jobs[i].start = split->starts[i];
+        jobs[i].count = split->counts[i];
+        if (!pool || !submitpool(pool, runjobparlst, &jobs[i])) runjobparlst(&jobs[i]);
+    }
+    waitpool(pool);
+}
+
+/**
+ * Divide lista em segmentos.
+ * 
+ * Percorre a lista uma vez guardando o primeiro nó e o tamanho de
+ * cada segmento. Listas menores que nseg geram um segmento por nó.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ * @param nseg quantidade de segmentos desejada (maior que zero).
+ * @return SplitList* pointer para divisão criada, ou NULL caso falhe.
+ */
+SplitList *createsplitlst(List *lst, int nseg) {
+    SplitList *split;
+    NodeList *ptr;
+    int i, j;
+
+    if (!lst || nseg <= 0) return NULL;
+    if (nseg > lst->size) nseg = lst->size;
+
+    split = (SplitList *) malloc(sizeof(SplitList));
+    if (!split) return NULL;
+    split->starts = (NodeList **) malloc((nseg + 1) * sizeof(NodeList *));
+    split->counts = (int *) malloc((nseg + 1) * sizeof(int));
+    if (!split->starts || !split->counts) {
+        destroysplitlst(split);
+        return NULL;
+    }
+    split->nseg = nseg;
+
+    ptr = lst->first;
+    for (i = 0; i < nseg; i++) {
+        split->starts[i] = ptr;
+        split->counts[i] = lst->size / nseg + (i < lst->size % nseg);
+        for (j = 0; j < split->counts[i]; j++) ptr = ptr->next;
+    }
+    return split;
+}
+
+/**
+ * Destroi divisão de lista.
+ * 
+ * @param split ponteiro SplitList a ser liberado.
+ */
+void destroysplitlst(SplitList *split) {
+    if (!split) return;
+    free(split->starts);
+    free(split->counts);
+    free(split);
+}
+
+/**
+ * Aplica função a todos os elementos em paralelo.
+ * 
+ * Cada segmento é processado por uma tarefa do pool. fn pode
+ * alterar a informação recebida, mas não a estrutura da lista.
+ * Com pool NULL os segmentos são processados na thread chamadora.
+ * 
+ * @param pool ponteiro ThreadPool que executa as tarefas, ou NULL.
+ * @param split ponteiro SplitList com os segmentos da lista.
+ * @param fn função que recebe a informação e arg.
+ * @param arg ponteiro repassado a fn.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int foreachparlst(ThreadPool *pool, SplitList *split, void (*fn)(InfoList *, void *), void *arg) {
+    JobParList *jobs;
+    int i;
+
+    if (!split || !fn) return 0;
+    if (split->nseg == 0) return 1;
+
+    jobs = (JobParList *) malloc(split->nseg * sizeof(JobParList));
+    if (!jobs) return 0;
+
+    for (i = 0; i < split->nseg; i++) {
+        jobs[i].fn = fn;
+        jobs[i].arg = arg;
+    }
+    runjobsparlst(pool, split, jobs);
+
+    free(jobs);
+    return 1;
+}
+
+/**
+ * Reduz elementos da lista em paralelo.
+ * 
+ * Cada segmento calcula combine(...combine(identity, map(x1))...,
+ * map(xk)) e os resultados parciais são combinados na ordem dos
+ * segmentos. combine deve ser associativa e identity seu elemento
+ * neutro. Soma, contagem por predicado, mínimo e máximo são casos
+ * particulares.
+ * 
+ * @param pool ponteiro ThreadPool que executa as tarefas, ou NULL.
+ * @param split ponteiro SplitList com os segmentos da lista.
+ * @param map função que recebe a informação e arg.
+ * @param combine função associativa que combina dois resultados.
+ * @param identity elemento neutro de combine.
+ * @param arg ponteiro repassado a map.
+ * @return long long resultado da redução, identity para lista vazia.
+ */
+long long reduceparlst(ThreadPool *pool, SplitList *split, long long (*map)(InfoList *, void *),
+                       long long (*combine)(long long, long long), long long identity, void *arg) {
+    JobParList *jobs;
+    long long acc = identity;
+    int i;
+
+    if (!split || !map || !combine || split->nseg == 0) return identity;
+
+    jobs = (JobParList *) malloc(split->nseg * sizeof(JobParList));
+    if (!jobs) return identity;
+
+    for (i = 0; i < split->nseg; i++) {
+        jobs[i].fn = NULL;
+        jobs[i].map = map;
+        jobs[i].combine = combine;
+        jobs[i].result = identity;
+        jobs[i].arg = arg;
+    }
+    runjobsparlst(pool, split, jobs);
+
+    for (i = 0; i < split->nseg; i++) acc = combine(acc, jobs[i].result);
+    free(jobs);
+    return acc;
+}
+
+/**
+ * Chave de ordenação: valor e nó de origem.
+ */
+typedef struct {
+    int value;
+    NodeList *node;
+} KeyParList;
+
+#define LESSKEYPARLST(a, b) ((a).value < (b).value)
+
+// Trechos estáveis, intercalados em paralelo: a ordenação inteira é estável.
+DEFINESTABLESORTTMP(runkeysparlst, KeyParList, LESSKEYPARLST)
+DEFINEPARALLELSORT(sortkeysparlst, KeyParList, LESSKEYPARLST, runkeysparlst)
+
+/**
+ * Tarefa de religação: trecho [from, to) do vetor de chaves.
+ */
+typedef struct {
+    KeyParList *keys;
+    int from, to, n;
+} JobLinkParList;
+
+/**
+ * Tarefa: religa os nós do trecho [from, to) na ordem das chaves.
+ */
+static void runlinkparlst(void *arg) {
+    JobLinkParList *job = (JobLinkParList *) arg;
+    KeyParList *keys = job->keys;
+    int i;
+
+    for (i = job->from; i < job->to; i++) {
+        keys[i].node->next = i + 1 < job->n ? keys[i + 1].node : NULL;
+    }
+}
+
+/**
+ * Ordena lista em paralelo.
+ * 
+ * Copia valores e nós para um vetor em uma passada, ordena o
+ * vetor com o merge sort paralelo de genparallelsort.h e religa
+ * os nós em paralelo. A ordenação é estável e dá o mesmo
+ * resultado de mergesortlst. Com pool NULL tudo é feito na thread
+ * chamadora.
+ * 
+ * @param pool ponteiro ThreadPool que executa as tarefas, ou NULL.
+ * @param lst ponteiro List da lista encadeada.
+ * @return int 1 para sucesso, 0 caso contrário (lista inalterada).
+ */
+int sortparlst(ThreadPool *pool, List *lst) {
+    KeyParList *keys, *tmp;
+    JobLinkParList *jobs;
+    NodeList *ptr;
+    int i, n, nthreads;
+
+    if (!lst) return 0;
+    if (lst->size < 2) return 1;
+
+    n = lst->size;
+    nthreads = pool ? lenpool(pool) : 1;
+    if (nthreads > n) nthreads = n;
+
+    keys = (KeyParList *) malloc(n * sizeof(KeyParList));
+    tmp = (KeyParList *) malloc(n * sizeof(KeyParList));
+    jobs = (JobLinkParList *) malloc(nthreads * sizeof(JobLinkParList));
+    if (!keys || !tmp || !jobs) {
+        free(keys);
+        free(tmp);
+        free(jobs);
+        return 0;
+    }
+
+    for (i = 0, ptr = lst->first; i < n; i++, ptr = ptr->next) {
+        keys[i].value = ptr->info->value;
+        keys[i].node = ptr;
+    }
+    if (!sortkeysparlst(pool, keys, tmp, n)) {
+        free(keys);
+        free(tmp);
+        free(jobs);
+        return 0;
+    }
+
+    for (i = 0; i < nthreads; i++) {
+        jobs[i].keys = keys;
+        jobs[i].n = n;
+        jobs[i].from = (int) ((long long) n * i / nthreads);
+        jobs[i].to = (int) ((long long) n * (i + 1) / nthreads);
+        if (!pool || !submitpool(pool, runlinkparlst, &jobs[i])) runlinkparlst(&jobs[i]);
+    }
+    waitpool(pool);
+    lst->first = keys[0].node;
+    lst->last = keys[n - 1].node;
+
+    free(keys);
+    free(tmp);
+    free(jobs);
+    return 1;
+}
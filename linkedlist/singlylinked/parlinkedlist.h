@@ -0,0 +1,108 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef PARLINKEDLIST_H
+#define PARLINKEDLIST_H
+
+#include "linkedlist.h"
+#include "../../threadpool/threadpool.h"
+
+/**
+ * Tarefas no pool.
+ * 
+ * foreachparlst, reduceparlst e sortparlst aguardam suas
+ * tarefas com waitpool, que espera por todas as tarefas do pool.
+ * Chamá-las de dentro de uma tarefa do mesmo pool trava: waitpool
+ * espera também pela tarefa chamadora, que nunca termina.
+ */
+
+/**
+ * Estruturas de dados
+ * 
+ * Pontos de divisão de uma lista em segmentos consecutivos de
+ * tamanhos aproximadamente iguais. Calculados em uma passada e
+ * reaproveitáveis enquanto a lista não tiver nós inseridos ou
+ * removidos.
+ */
+
+typedef struct {
+    NodeList **starts;
+    int *counts;
+    int nseg;
+} SplitList;
+
+/**
+ * Divide lista em segmentos.
+ * 
+ * Percorre a lista uma vez guardando o primeiro nó e o tamanho de
+ * cada segmento. Listas menores que nseg geram um segmento por nó.
+ * 
+ * @param lst ponteiro List da lista encadeada.
+ * @param nseg quantidade de segmentos desejada (maior que zero).
+ * @return SplitList* pointer para divisão criada, ou NULL caso falhe.
+ */
+SplitList *createsplitlst(List *lst, int nseg);
+
+/**
+ * Destroi divisão de lista.
+ * 
+ * @param split ponteiro SplitList a ser liberado.
+ */
+void destroysplitlst(SplitList *split);
+
+/**
+ * Aplica função a todos os elementos em paralelo.
+ * 
+ * Cada segmento é processado por uma tarefa do pool. fn pode
+ * alterar a informação recebida, mas não a estrutura da lista.
+ * Com pool NULL os segmentos são processados na thread chamadora.
+ * 
+ * @param pool ponteiro ThreadPool que executa as tarefas, ou NULL.
+ * @param split ponteiro SplitList com os segmentos da lista.
+ * @param fn função que recebe a informação e arg.
+ * @param arg ponteiro repassado a fn.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int foreachparlst(ThreadPool *pool, SplitList *split, void (*fn)(InfoList *, void *), void *arg);
+
+/**
+ * Reduz elementos da lista em paralelo.
+ * 
+ * Cada segmento calcula combine(...combine(identity, map(x1))...,
+ * map(xk)) e os resultados parciais são combinados na ordem dos
+ * segmentos. combine deve ser associativa e identity seu elemento
+ * neutro. Soma, contagem por predicado, mínimo e máximo são casos
+ * particulares.
+ * 
+ * @param pool ponteiro ThreadPool que executa as tarefas, ou NULL.
+ * @param split ponteiro SplitList com os segmentos da lista.
+ * @param map função que recebe a informação e arg.
+ * @param combine função associativa que combina dois resultados.
+ * @param identity elemento neutro de combine.
+ * @param arg ponteiro repassado a map.
+ * @return long long resultado da redução, identity para lista vazia.
+ */
+long long reduceparlst(ThreadPool *pool, SplitList *split, long long (*map)(InfoList *, void *),
+                       long long (*combine)(long long, long long), long long identity, void *arg);
+
+/**
+ * Ordena lista em paralelo.
+ * 
+ * Copia valores e nós para um vetor em uma passada, ordena o
+ * vetor com o merge sort paralelo de genparallelsort.h e religa
+ * os nós em paralelo. A ordenação é estável e dá o mesmo
+ * resultado de mergesortlst. Com pool NULL tudo é feito na thread
+ * chamadora.
+ * 
+ * @param pool ponteiro ThreadPool que executa as tarefas, ou NULL.
+ * @param lst ponteiro List da lista encadeada.
+ * @return int 1 para sucesso, 0 caso contrário (lista inalterada).
+ */
+int sortparlst(ThreadPool *pool, List *lst);
+
+#endif
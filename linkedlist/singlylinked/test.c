@@ -7,6 +7,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include "linkedlist.h"
 
 // dummy test
@@ -42,5 +43,82 @@ int main() {
     delfirstlst(lst);
     printlst(lst);
 
+    // Percorre a lista com cursor, removendo valores ímpares
+    // e inserindo um quarto do valor antes dos pares em uma única passada.
+    // Output: [ (3) (12) (12) (48) ]
+    CursorList cur;
+    insertlastlst(lst, lstinfo(12));
+    insertfirstlst(lst, lstinfo(48));
+    initcursorlst(&cur, lst);
+    while (!endcursorlst(&cur)) {
+        if (getcursorlst(&cur)->value % 2) free(delcursorlst(&cur));
+        else {
+            insertbeforecursorlst(&cur, lstinfo(getcursorlst(&cur)->value / 4));
+            nextcursorlst(&cur);
+        }
+    }
+    sortlst(lst);
+    printlst(lst);
+
+    // Divide a lista ao meio e concatena as metades invertidas.
+    // Output: [ (48) (12) (12) (3) ]
+    List *half = splithalflst(lst);
+    reverselst(lst);
+    reverselst(half);
+    concatlst(half, lst);
+    printlst(half);
+
+    // Remove todos os valores menores que 20 em uma passada,
+    // guardando os removidos em um vetor.
+    // Output: [ (48) ], 3 removidos
+    InfoList *removed[4];
+    int i, count;
+    REMOVEIFLST(half, info, info->value < 20, removed, count);
+    printlst(half);
+    printf("%d removidos\n", count);
+    for (i = 0; i < count; i++) free(removed[i]);
+
+    // Operações de conjunto e remoção de repetidos em tempo linear.
+    // Output: [ (48) (12) ], [ (48) ] e [ (12) (48) ]
+    List *uni, *inter;
+    insertlastlst(lst, lstinfo(12));
+    insertlastlst(lst, lstinfo(48));
+    insertlastlst(lst, lstinfo(12));
+    uni = unionlst(half, lst);
+    inter = intersectlst(lst, half);
+    deduplst(lst);
+    printlst(uni);
+    printlst(inter);
+    printlst(lst);
+
+    // Constrói lista a partir de vetor e exporta de volta.
+    // Output: [ (5) (1) (4) ] e 3 valores copiados
+    int arr[] = { 5, 1, 4 }, copy[3];
+    List *fromarr = arraytolst(arr, 3);
+    printlst(fromarr);
+    printf("%d valores copiados\n", lsttoarray(fromarr, copy));
+    destroylst(fromarr);
+
+    // Reorganiza nós de lst em um bloco contíguo.
+    // Output: [ (12) (48) ]
+    relayoutlst(lst);
+    printlst(lst);
+
+    // Busca com prefetch de 2 nós à frente.
+    // Output: 48 encontrado
+    InfoList key = { 48 };
+    if (findpflst(lst, &key, 2)) printf("%d encontrado\n", key.value);
+
+    // Ordena religando nós (merge sort).
+    // Output: [ (5) (12) (31) (48) ]
+    insertfirstlst(lst, lstinfo(31));
+    insertlastlst(lst, lstinfo(5));
+    mergesortlst(lst);
+    printlst(lst);
+
+    destroylst(inter);
+    destroylst(uni);
+    destroylst(half);
+    destroylst(lst);
     return 0;
 }
\ No newline at end of file
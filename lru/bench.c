@@ -0,0 +1,112 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "lru.h"
+
+// Compilar com:
+//   gcc -O2 bench.c lru.c -lm
+
+#define KEYS 1000000
+#define OPS 10000000
+
+double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+unsigned long long rng = 88172645463325252ULL;
+
+double uniform() {
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return (rng >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Sequência de chaves com distribuição de Zipf de expoente s:
+// a chave de posição r tem probabilidade proporcional a 1/r^s.
+// As posições são embaralhadas para que chaves populares não
+// sejam vizinhas.
+void zipf(int *keys, int n, double s) {
+    double *cdf = (double *) malloc(KEYS * sizeof(double));
+    int *perm = (int *) malloc(KEYS * sizeof(int));
+    double u, total = 0;
+    int i, j, tmp, lo, hi, mid;
+
+    for (i = 0; i < KEYS; i++) {
+        total += 1.0 / pow(i + 1, s);
+        cdf[i] = total;
+        perm[i] = i;
+    }
+    for (i = KEYS - 1; i > 0; i--) {
+        j = (int) (uniform() * (i + 1));
+        tmp = perm[i]; perm[i] = perm[j]; perm[j] = tmp;
+    }
+    for (i = 0; i < n; i++) {
+        u = uniform() * total;
+        for (lo = 0, hi = KEYS - 1; lo < hi; ) {
+            mid = (lo + hi) / 2;
+            if (cdf[mid] < u) lo = mid + 1;
+            else hi = mid;
+        }
+        keys[i] = perm[lo];
+    }
+    free(perm);
+    free(cdf);
+}
+
+long evictions;
+
+void evicted(int key, int value, void *arg) {
+    (void) key;
+    (void) value;
+    (void) arg;
+    evictions++;
+}
+
+int main() {
+    double exps[] = { 0.8, 0.99, 1.2 };
+    int caps[] = { 1000, 10000, 100000 };
+    int *keys = (int *) malloc(OPS * sizeof(int));
+    int e, c, i, value;
+    long hits;
+    double t;
+    Lru *cache;
+
+    printf("%6s %9s %9s %10s %10s\n", "zipf s", "capac.", "acerto %", "descartes", "Mops/s");
+
+    for (e = 0; e < 3; e++) {
+        zipf(keys, OPS, exps[e]);
+        for (c = 0; c < 3; c++) {
+            cache = createlru(caps[c], evicted, NULL);
+            hits = evictions = 0;
+
+            // Cache-aside: consulta e, em caso de falta, grava.
+            t = now();
+            for (i = 0; i < OPS; i++) {
+                if (getlru(cache, keys[i], &value)) hits++;
+                else putlru(cache, keys[i], keys[i]);
+            }
+            t = now() - t;
+
+            printf("%6.2f %9d %9.2f %10ld %10.2f\n", exps[e], caps[c],
+                   100.0 * hits / OPS, evictions, OPS / t / 1e6);
+            destroylru(cache);
+        }
+    }
+
+    free(keys);
+    return 0;
+}
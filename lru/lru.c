@@ -0,0 +1,284 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "lru.h"
+
+/**
+ * Posição inicial de uma chave na tabela hash.
+ *
+ * @param cache ponteiro Lru do cache.
+ * @param key chave.
+ * @return unsigned índice em cache->slots.
+ */
+static unsigned homelru(Lru *cache, int key) {
+    unsigned h = (unsigned) key;
+
+    h ^= h >> 16;
+    h *= 0x45d9f3bu;
+    h ^= h >> 16;
+    return h & cache->mask;
+}
+
+/**
+ * Procura posição de uma chave na tabela hash.
+ *
+ * @param cache ponteiro Lru do cache.
+ * @param key chave.
+ * @return unsigned índice da entrada com a chave, ou do primeiro
+ *                  espaço livre caso não exista.
+ */
+static unsigned slotlru(Lru *cache, int key) {
+    unsigned i = homelru(cache, key);
+
+    while (cache->slots[i] && cache->slots[i]->key != key) i = (i + 1) & cache->mask;
+    return i;
+}
+
+/**
+ * Remove entrada da tabela hash.
+ *
+ * Desloca para trás as entradas seguintes da mesma sequência de
+ * sondagem, de forma que a tabela não acumula marcas de remoção.
+ *
+ * @param cache ponteiro Lru do cache.
+ * @param i índice da entrada a ser removida.
+ */
+static void unhashlru(Lru *cache, unsigned i) {
+    unsigned j = i, k;
+
+    for (;;) {
+        j = (j + 1) & cache->mask;
+        if (!cache->slots[j]) break;
+        k = homelru(cache, cache->slots[j]->key);
+        // Move se a posição inicial de j não está em (i, j].
+        if ((i < j) ? (k <= i || k > j) : (k <= i && k > j)) {
+            cache->slots[i] = cache->slots[j];
+            i = j;
+        }
+    }
+    cache->slots[i] = NULL;
+}
+
+/**
+ * Desliga entrada da lista de recência.
+ *
+ * @param cache ponteiro Lru do cache.
+ * @param entry ponteiro EntryLru a ser desligado.
+ */
+static void unlinklru(Lru *cache, EntryLru *entry) {
+    if (entry->prev) entry->prev->next = entry->next;
+    else cache->first = entry->next;
+    if (entry->next) entry->next->prev = entry->prev;
+    else cache->last = entry->prev;
+}
+
+/**
+ * Liga entrada no início da lista de recência.
+ *
+ * @param cache ponteiro Lru do cache.
+ * @param entry ponteiro EntryLru a ser ligado.
+ */
+static void pushlru(Lru *cache, EntryLru *entry) {
+    entry->prev = NULL;
+    entry->next = cache->first;
+    if (cache->first) cache->first->prev = entry;
+    else cache->last = entry;
+    cache->first = entry;
+}
+
+/**
+ * Cria cache LRU.
+ *
+ * Toda a memória é alocada aqui; as operações seguintes não
+ * alocam nem liberam memória.
+ *
+ * @param capacity quantidade máxima de entradas (maior que zero).
+ * @param evict função chamada com a entrada descartada por falta
+ *              de espaço, ou NULL.
+ * @param arg ponteiro repassado a evict.
+ * @return Lru* pointer para cache criado, ou NULL caso falhe.
+ */
+Lru *createlru(int capacity, void (*evict)(int key, int value, void *arg), void *arg) {
+    Lru *cache;
+    unsigned nslots = 2;
+    int i;
+
+    if (capacity <= 0) return NULL;
+    while (nslots < 2 * (unsigned) capacity) nslots *= 2;
+
+    cache = (Lru *) malloc(sizeof(Lru));
+    if (!cache) return NULL;
+    cache->entries = (EntryLru *) malloc(capacity * sizeof(EntryLru));
+    cache->slots = (EntryLru **) calloc(nslots, sizeof(EntryLru *));
+    if (!cache->entries || !cache->slots) {
+        free(cache->entries);
+        free(cache->slots);
+        free(cache);
+        return NULL;
+    }
+
+    for (i = 0; i < capacity - 1; i++) cache->entries[i].next = &cache->entries[i + 1];
+    cache->entries[capacity - 1].next = NULL;
+    cache->free = cache->entries;
+
+    cache->size = 0;
+    cache->capacity = capacity;
+    cache->first = cache->last = NULL;
+    cache->mask = nslots - 1;
+    cache->evict = evict;
+    cache->arg = arg;
+    return cache;
+}
+
+/**
+ * Destroi cache.
+ *
+ * Não chama a função de descarte para as entradas restantes.
+ *
+ * @param cache ponteiro Lru do cache.
+ */
+void destroylru(Lru *cache) {
+    if (!cache) return;
+    free(cache->entries);
+    free(cache->slots);
+    free(cache);
+}
+
+/**
+ * Consulta chave no cache.
+ *
+ * Em caso de acerto a entrada passa a ser a mais recente.
+ *
+ * @param cache ponteiro Lru do cache.
+ * @param key chave a ser buscada.
+ * @param value ponteiro que recebe o valor, ou NULL.
+ * @return int 1 caso a chave esteja no cache, 0 caso contrário.
+ */
+int getlru(Lru *cache, int key, int *value) {
+    EntryLru *entry;
+
+    if (!cache) return 0;
+
+    entry = cache->slots[slotlru(cache, key)];
+    if (!entry) return 0;
+
+    if (entry != cache->first) {
+        unlinklru(cache, entry);
+        pushlru(cache, entry);
+    }
+    if (value) *value = entry->value;
+    return 1;
+}
+
+/**
+ * Grava par no cache.
+ *
+ * Atualiza o valor caso a chave exista. Caso contrário insere
+ * nova entrada, descartando a menos recente se o cache estiver
+ * cheio. Em ambos os casos a entrada passa a ser a mais recente.
+ *
+ * @param cache ponteiro Lru do cache.
+ * @param key chave a ser gravada.
+ * @param value valor associado à chave.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int putlru(Lru *cache, int key, int value) {
+    EntryLru *entry;
+    unsigned i;
+
+    if (!cache) return 0;
+
+    i = slotlru(cache, key);
+    entry = cache->slots[i];
+    if (entry) {
+        entry->value = value;
+        if (entry != cache->first) {
+            unlinklru(cache, entry);
+            pushlru(cache, entry);
+        }
+        return 1;
+    }
+
+    if (cache->size == cache->capacity) {
+        entry = cache->last;
+        unlinklru(cache, entry);
+        unhashlru(cache, slotlru(cache, entry->key));
+        cache->size--;
+        if (cache->evict) cache->evict(entry->key, entry->value, cache->arg);
+        // A remoção pode ter deslocado a posição livre da nova chave.
+        i = slotlru(cache, key);
+    }
+    else {
+        entry = cache->free;
+        cache->free = entry->next;
+    }
+
+    entry->key = key;
+    entry->value = value;
+    cache->slots[i] = entry;
+    pushlru(cache, entry);
+    cache->size++;
+    return 1;
+}
+
+/**
+ * Remove chave do cache.
+ *
+ * Não chama a função de descarte.
+ *
+ * @param cache ponteiro Lru do cache.
+ * @param key chave a ser removida.
+ * @return int 1 caso a chave existisse, 0 caso contrário.
+ */
+int dellru(Lru *cache, int key) {
+    EntryLru *entry;
+    unsigned i;
+
+    if (!cache) return 0;
+
+    i = slotlru(cache, key);
+    entry = cache->slots[i];
+    if (!entry) return 0;
+
+    unlinklru(cache, entry);
+    unhashlru(cache, i);
+    entry->next = cache->free;
+    cache->free = entry;
+    cache->size--;
+    return 1;
+}
+
+/**
+ * Ver quantidade de entradas do cache.
+ *
+ * @param cache ponteiro Lru do cache.
+ * @return int quantidade de entradas, -1 caso cache não exista.
+ */
+int lenlru(Lru *cache) {
+    if (!cache) return -1;
+    return cache->size;
+}
+
+/**
+ * Imprime entradas do cache.
+ *
+ * Da mais recente para a menos recente, no formato (chave: valor).
+ *
+ * @param cache ponteiro Lru do cache.
+ */
+void printlru(Lru *cache) {
+    EntryLru *ptr;
+
+    if (!cache || cache->size == 0) return;
+
+    printf("\n[ ");
+    for (ptr = cache->first; ptr; ptr = ptr->next) printf("(%d: %d) ", ptr->key, ptr->value);
+    printf("]\n");
+}
@@ -0,0 +1,114 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef LRU_H
+#define LRU_H
+
+/**
+ * Estruturas de dados
+ *
+ * Cache de pares chave/valor inteiros com política LRU (least
+ * recently used). As entradas ficam em um vetor alocado na
+ * criação e carregam os próprios ponteiros da lista de recência
+ * (lista intrusiva); uma tabela hash de endereçamento aberto com
+ * sondagem linear localiza a entrada de cada chave.
+ */
+
+typedef struct lrunode {
+    int key, value;
+    struct lrunode *prev, *next;
+} EntryLru;
+
+typedef struct {
+    int size, capacity;
+    EntryLru *entries, *free;
+    EntryLru *first, *last;
+    EntryLru **slots;
+    unsigned mask;
+    void (*evict)(int key, int value, void *arg);
+    void *arg;
+} Lru;
+
+/**
+ * Cria cache LRU.
+ *
+ * Toda a memória é alocada aqui; as operações seguintes não
+ * alocam nem liberam memória.
+ *
+ * @param capacity quantidade máxima de entradas (maior que zero).
+ * @param evict função chamada com a entrada descartada por falta
+ *              de espaço, ou NULL.
+ * @param arg ponteiro repassado a evict.
+ * @return Lru* pointer para cache criado, ou NULL caso falhe.
+ */
+Lru *createlru(int capacity, void (*evict)(int key, int value, void *arg), void *arg);
+
+/**
+ * Destroi cache.
+ *
+ * Não chama a função de descarte para as entradas restantes.
+ *
+ * @param cache ponteiro Lru do cache.
+ */
+void destroylru(Lru *cache);
+
+/**
+ * Consulta chave no cache.
+ *
+ * Em caso de acerto a entrada passa a ser a mais recente.
+ *
+ * @param cache ponteiro Lru do cache.
+ * @param key chave a ser buscada.
+ * @param value ponteiro que recebe o valor, ou NULL.
+ * @return int 1 caso a chave esteja no cache, 0 caso contrário.
+ */
+int getlru(Lru *cache, int key, int *value);
+
+/**
+ * Grava par no cache.
+ *
+ * Atualiza o valor caso a chave exista. Caso contrário insere
+ * nova entrada, descartando a menos recente se o cache estiver
+ * cheio. Em ambos os casos a entrada passa a ser a mais recente.
+ *
+ * @param cache ponteiro Lru do cache.
+ * @param key chave a ser gravada.
+ * @param value valor associado à chave.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int putlru(Lru *cache, int key, int value);
+
+/**
+ * Remove chave do cache.
+ *
+ * Não chama a função de descarte.
+ *
+ * @param cache ponteiro Lru do cache.
+ * @param key chave a ser removida.
+ * @return int 1 caso a chave existisse, 0 caso contrário.
+ */
+int dellru(Lru *cache, int key);
+
+/**
+ * Ver quantidade de entradas do cache.
+ *
+ * @param cache ponteiro Lru do cache.
+ * @return int quantidade de entradas, -1 caso cache não exista.
+ */
+int lenlru(Lru *cache);
+
+/**
+ * Imprime entradas do cache.
+ *
+ * Da mais recente para a menos recente, no formato (chave: valor).
+ *
+ * @param cache ponteiro Lru do cache.
+ */
+void printlru(Lru *cache);
+
+#endif
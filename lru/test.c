@@ -0,0 +1,48 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include "lru.h"
+
+void evicted(int key, int value, void *arg) {
+    (void) arg;
+    printf("descartado (%d: %d)\n", key, value);
+}
+
+// dummy test
+int main() {
+    Lru *cache = createlru(3, evicted, NULL);
+    int value;
+
+    // Grava 3 entradas; a mais recente aparece primeiro.
+    // Output: [ (3: 30) (2: 20) (1: 10) ]
+    putlru(cache, 1, 10);
+    putlru(cache, 2, 20);
+    putlru(cache, 3, 30);
+    printlru(cache);
+
+    // Consulta a chave 1, que passa a ser a mais recente.
+    // Output: 1 -> 10 e [ (1: 10) (3: 30) (2: 20) ]
+    if (getlru(cache, 1, &value)) printf("1 -> %d\n", value);
+    printlru(cache);
+
+    // Cache cheio: a chave 2 é a menos recente e é descartada.
+    // Output: descartado (2: 20) e [ (4: 40) (1: 10) (3: 30) ]
+    putlru(cache, 4, 40);
+    printlru(cache);
+
+    // Atualiza chave existente e remove outra.
+    // Output: [ (3: 33) (4: 40) ], 2 ausente
+    putlru(cache, 3, 33);
+    dellru(cache, 1);
+    printlru(cache);
+    if (!getlru(cache, 2, NULL)) printf("2 ausente\n");
+
+    destroylru(cache);
+    return 0;
+}
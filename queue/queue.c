@@ -9,6 +9,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "queue.h"
+#include "../linkedlist/pfscan.h"
 
 /**
  * Cria cabeça de fila.
@@ -185,6 +186,27 @@ int isinqueue(Queue *queue, InfoQueue *info) {
     return 0;
 }
 
+/**
+ * Verifica presença de informação na fila com prefetch.
+ * 
+ * Mesmo resultado de isinqueue, pedindo ao processador a informação
+ * de cada nó dist nós antes da comparação. Os nós continuam sendo
+ * lidos um a um; ver linkedlist/pfscan.h.
+ * 
+ * @param queue ponteiro Queue da fila.
+ * @param info ponteiro InfoQueue com informação a ser buscada.
+ * @param dist distância de prefetch em nós, ou <= 0 para PFSCAN_DIST.
+ * @return int 1 caso exista na fila, 0 caso contrário.
+ */
+int isinpfqueue(Queue *queue, InfoQueue *info, int dist) {
+    if (isemptyqueue(queue)) return 0;
+
+    PFSCAN(NodeQueue, ptr, queue->first, NEXTPFSCAN, dist,
+        if (ptr->info->value == info->value) return 1;
+    );
+    return 0;
+}
+
 /**
  * Imprime elementos de fila.
  * 
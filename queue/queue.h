@@ -118,6 +118,20 @@ InfoQueue *removequeue(Queue *queue);
  */
 int isinqueue(Queue *queue, InfoQueue *info);
 
+/**
+ * Verifica presença de informação na fila com prefetch.
+ * 
+ * Mesmo resultado de isinqueue, pedindo ao processador a informação
+ * de cada nó dist nós antes da comparação. Os nós continuam sendo
+ * lidos um a um; ver linkedlist/pfscan.h.
+ * 
+ * @param queue ponteiro Queue da fila.
+ * @param info ponteiro InfoQueue com informação a ser buscada.
+ * @param dist distância de prefetch em nós, ou <= 0 para PFSCAN_DIST.
+ * @return int 1 caso exista na fila, 0 caso contrário.
+ */
+int isinpfqueue(Queue *queue, InfoQueue *info, int dist);
+
 /**
  * Imprime elementos de fila.
  * 
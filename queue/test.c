@@ -36,5 +36,10 @@ int main() {
     reversequeue(queue);
     printqueue(queue);
 
+    // Verifica se elemento está na fila, com prefetch padrão
+    // Output: Está contido na fila.
+    if (isinpfqueue(queue, info3, 0)) printf("\nEstá contido na fila.\n");
+    else printf("\nNão está na fila.\n");
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,101 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "externalsort.c"
+
+// Compilar com:
+//   gcc -O2 bench_externalsort.c
+//
+// Uso: ./a.out [memória em MB] [fan-in]  (padrão: 16 MB, 16)
+//
+// Gera arquivos de 1x, 4x e 16x o orçamento no diretório atual.
+// Com memória livre sobrando, o sistema mantém os arquivos em
+// cache e o tempo medido é quase só de CPU e cópias.
+
+#define INPUT "bench_externalsort.in"
+#define OUTPUT "bench_externalsort.out"
+
+double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+// Grava n ints aleatórios em blocos.
+int generate(long long n) {
+    static int buf[1 << 16];
+    FILE *f = fopen(INPUT, "wb");
+    long long done;
+    int i, len;
+
+    if (!f) return 0;
+    for (done = 0; done < n; done += len) {
+        len = n - done < (1 << 16) ? (int) (n - done) : (1 << 16);
+        for (i = 0; i < len; i++) buf[i] = rand();
+        fwrite(buf, sizeof(int), len, f);
+    }
+    return fclose(f) == 0;
+}
+
+// Confere ordem e quantidade do arquivo de saída.
+int verify(long long n) {
+    static int buf[1 << 16];
+    FILE *f = fopen(OUTPUT, "rb");
+    long long count = 0;
+    int i, len, last = 0, ok = 1;
+
+    if (!f) return 0;
+    while ((len = (int) fread(buf, sizeof(int), 1 << 16, f)) > 0) {
+        for (i = 0; i < len; i++) {
+            if (count + i > 0 && buf[i] < last) ok = 0;
+            last = buf[i];
+        }
+        count += len;
+    }
+    fclose(f);
+    return ok && count == n;
+}
+
+int main(int argc, char **argv) {
+    int mb = argc > 1 ? atoi(argv[1]) : 16;
+    int fanin = argc > 2 ? atoi(argv[2]) : 16;
+    int factors[] = { 1, 4, 16 };
+    size_t memory = (size_t) mb << 20;
+    long long n, runs, left;
+    int f, passes, ok;
+    double t0, t;
+
+    printf("orçamento %d MB, fan-in %d\n", mb, fanin);
+    printf("%8s %10s %8s %8s %10s %10s\n", "arquivo", "MB", "seqs", "passadas", "s", "MB/s");
+
+    srand(42);
+    for (f = 0; f < 3; f++) {
+        n = (long long) factors[f] * memory / sizeof(int);
+        if (!generate(n)) return 1;
+
+        // Passadas de intercalação, incluindo a final.
+        runs = (n * (long long) sizeof(int) + memory - 1) / memory;
+        for (left = runs, passes = 1; left > fanin; passes++) left = (left + fanin - 1) / fanin;
+
+        t0 = now();
+        ok = externalsort(INPUT, OUTPUT, memory, fanin);
+        t = now() - t0;
+
+        printf("%7dx %10.0f %8lld %8d %10.2f %10.1f%s\n", factors[f], n * sizeof(int) / 1048576.0,
+               runs, passes, t, n * sizeof(int) / 1048576.0 / t, ok && verify(n) ? "" : " (falhou!)");
+        remove(INPUT);
+        remove(OUTPUT);
+    }
+    return 0;
+}
@@ -0,0 +1,126 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "gensort.h"
+#include "introsort.c"
+
+// Compilar com:
+//   gcc -O2 bench_gensort.c
+//
+// Uso: ./a.out [n]  (padrão: 5000000 elementos)
+
+typedef struct {
+    long long key;
+    long long payload;
+} Record;
+
+#define LESSNUM(a, b) ((a) < (b))
+#define BYKEY(a, b) ((a).key < (b).key)
+
+DEFINESORT(sortint, int, LESSNUM)
+DEFINESORT(sortdouble, double, LESSNUM)
+DEFINESORT(sortrecord, Record, BYKEY)
+DEFINESTABLESORT(stablesortrecord, Record, BYKEY)
+
+int cmpint(const void *a, const void *b) {
+    int x = *(const int *) a, y = *(const int *) b;
+    return (x > y) - (x < y);
+}
+
+int cmpdouble(const void *a, const void *b) {
+    double x = *(const double *) a, y = *(const double *) b;
+    return (x > y) - (x < y);
+}
+
+int cmprecord(const void *a, const void *b) {
+    long long x = ((const Record *) a)->key, y = ((const Record *) b)->key;
+    return (x > y) - (x < y);
+}
+
+double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 5000000;
+    int *ints = (int *) malloc(n * sizeof(int)), *iwork = (int *) malloc(n * sizeof(int));
+    double *dbls = (double *) malloc(n * sizeof(double)), *dwork = (double *) malloc(n * sizeof(double));
+    Record *recs = (Record *) malloc(n * sizeof(Record)), *rwork = (Record *) malloc(n * sizeof(Record));
+    double t0, tq, tg;
+    int i;
+
+    srand(42);
+    for (i = 0; i < n; i++) {
+        ints[i] = rand();
+        dbls[i] = rand() / (double) RAND_MAX;
+        recs[i].key = rand();
+        recs[i].payload = i;
+    }
+
+    printf("n = %d\n", n);
+    printf("%-22s %10s %10s %8s\n", "", "qsort s", "gensort s", "speedup");
+
+    memcpy(iwork, ints, n * sizeof(int));
+    t0 = now();
+    qsort(iwork, n, sizeof(int), cmpint);
+    tq = now() - t0;
+    memcpy(iwork, ints, n * sizeof(int));
+    t0 = now();
+    sortint(iwork, n);
+    tg = now() - t0;
+    printf("%-22s %10.3f %10.3f %7.2fx\n", "int", tq, tg, tq / tg);
+
+    // Referência: a versão só para int de introsort.c.
+    memcpy(iwork, ints, n * sizeof(int));
+    t0 = now();
+    introsort(iwork, n);
+    printf("%-22s %10s %10.3f\n", "int (introsort.c)", "", now() - t0);
+
+    memcpy(dwork, dbls, n * sizeof(double));
+    t0 = now();
+    qsort(dwork, n, sizeof(double), cmpdouble);
+    tq = now() - t0;
+    memcpy(dwork, dbls, n * sizeof(double));
+    t0 = now();
+    sortdouble(dwork, n);
+    tg = now() - t0;
+    printf("%-22s %10.3f %10.3f %7.2fx\n", "double", tq, tg, tq / tg);
+
+    memcpy(rwork, recs, n * sizeof(Record));
+    t0 = now();
+    qsort(rwork, n, sizeof(Record), cmprecord);
+    tq = now() - t0;
+    memcpy(rwork, recs, n * sizeof(Record));
+    t0 = now();
+    sortrecord(rwork, n);
+    tg = now() - t0;
+    printf("%-22s %10.3f %10.3f %7.2fx\n", "registro 16 bytes", tq, tg, tq / tg);
+
+    memcpy(rwork, recs, n * sizeof(Record));
+    t0 = now();
+    stablesortrecord(rwork, n);
+    tg = now() - t0;
+    printf("%-23s %10.3f %10.3f %7.2fx\n", "registro 16 (estável)", tq, tg, tq / tg);  // 'é' ocupa 2 bytes
+
+    free(ints);
+    free(iwork);
+    free(dbls);
+    free(dwork);
+    free(recs);
+    free(rwork);
+    return 0;
+}
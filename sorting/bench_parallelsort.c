@@ -0,0 +1,64 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "parallelsort.c"
+
+// Compilar com:
+//   gcc -O2 bench_parallelsort.c ../threadpool/threadpool.c -pthread
+//
+// Uso: ./a.out [n]  (padrão: 50000000 elementos)
+
+double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 50000000;
+    int ncpu = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    int *input, *arr;
+    int i, nthreads, sorted;
+    double t0, t, tbase = 0;
+
+    input = (int *) malloc(n * sizeof(int));
+    arr = (int *) malloc(n * sizeof(int));
+    if (!input || !arr) return 1;
+
+    srand(42);
+    for (i = 0; i < n; i++) input[i] = rand();
+    if (ncpu < 1) ncpu = 1;
+
+    printf("n = %d (%.0f MB); memória extra com 2 ou mais threads: %.0f MB (n ints)\n",
+           n, n * sizeof(int) / 1048576.0, n * sizeof(int) / 1048576.0);
+    printf("%8s %10s %10s %10s\n", "threads", "s", "speedup", "eficiência");
+
+    for (nthreads = 1; ; nthreads = nthreads * 2 < ncpu ? nthreads * 2 : ncpu) {
+        memcpy(arr, input, n * sizeof(int));
+        t0 = now();
+        parallelsortthreads(arr, n, nthreads);
+        t = now() - t0;
+
+        for (i = 1, sorted = 1; i < n && sorted; i++) sorted = arr[i - 1] <= arr[i];
+        if (nthreads == 1) tbase = t;
+        printf("%8d %10.3f %9.2fx %9.0f%%%s\n", nthreads, t, tbase / t, 100 * tbase / t / nthreads,
+               sorted ? "" : " (fora de ordem!)");
+        if (nthreads == ncpu) break;
+    }
+
+    free(input);
+    free(arr);
+    return 0;
+}
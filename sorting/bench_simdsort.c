@@ -0,0 +1,73 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "simdsort.c"
+
+// Compilar com:
+//   gcc -O2 bench_simdsort.c
+
+#define TOTAL (1 << 22)    // elementos ordenados por medição
+
+double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+// Ordena TOTAL / n vetores de n elementos; ns por vetor.
+double run(const KernelSimd *k, const int *input, int *work, int n) {
+    double t0;
+    int i, reps = TOTAL / n;
+
+    memcpy(work, input, TOTAL * sizeof(int));
+    t0 = now();
+    for (i = 0; i < reps; i++) {
+        if (k) sortkernelsimd(k, work + i * n, n);
+        else insertionsort(work + i * n, n);
+    }
+    return (now() - t0) * 1e9 / reps;
+}
+
+int main() {
+    int *input = (int *) malloc(TOTAL * sizeof(int));
+    int *work = (int *) malloc(TOTAL * sizeof(int));
+    int n, i, sse41 = 0, avx2 = 0;
+
+#ifdef SIMDSORT_X86
+    sse41 = __builtin_cpu_supports("sse4.1");
+    avx2 = __builtin_cpu_supports("avx2");
+#endif
+
+    srand(42);
+    for (i = 0; i < TOTAL; i++) input[i] = rand();
+
+    printf("simdsort usa %s; ns por vetor\n", simdsortisa());
+    printf("%6s %14s %10s %10s %10s %9s\n", "n", "insertionsort", "escalar", "sse4.1", "avx2", "speedup");
+    for (n = 8; n <= 256; n *= 2) {
+        double tins = run(NULL, input, work, n);
+        double tsca = run(&scalarsimd, input, work, n);
+        double tsse = 0, tavx = 0;
+#ifdef SIMDSORT_X86
+        if (sse41) tsse = run(&sse41simd, input, work, n);
+        if (avx2) tavx = run(&avx2simd, input, work, n);
+#endif
+        printf("%6d %14.1f %10.1f %10.1f %10.1f %8.2fx\n", n, tins, tsca, tsse, tavx,
+               tins / (avx2 ? tavx : sse41 ? tsse : tsca));
+    }
+
+    free(input);
+    free(work);
+    return 0;
+}
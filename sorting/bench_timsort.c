@@ -0,0 +1,88 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "timsort.c"
+#include "patterns.c"
+
+// Compilar com:
+//   gcc -O2 bench_timsort.c
+//
+// Uso: ./a.out [n]  (padrão: 5000000 elementos)
+
+#define INSERTION_MAX 100000    // insertion sort só até esse tamanho
+
+double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+// Preenche o vetor com um padrão de entrada.
+void fill(int *arr, int n, int kind) {
+    switch (kind) {
+        case 0: sortedpattern(arr, n); break;
+        case 1: reversedpattern(arr, n); break;
+        case 2: nearlysortedpattern(arr, n, 1000); break;  // 0.1% fora do lugar
+        case 3: tailpattern(arr, n, n / 100); break;       // cauda de 1%
+        default: randompattern(arr, n);
+    }
+}
+
+// Tempo de uma ordenação em segundos.
+double run(void (*sort)(int *, int), const int *input, int *work, int n) {
+    double t0;
+
+    memcpy(work, input, n * sizeof(int));
+    t0 = now();
+    sort(work, n);
+    return now() - t0;
+}
+
+void table(int n) {
+    const char *names[] = { "ordenado", "invertido", "quase ord.", "cauda 1%", "aleatório" };
+    int *input = (int *) malloc(n * sizeof(int));
+    int *work = (int *) malloc(n * sizeof(int));
+    double tins, tintro, tbl, ttim;
+    int kind;
+
+    printf("n = %d\n", n);
+    printf("%-12s %12s %12s %12s %12s %9s\n", "entrada", "insertion s", "introsort s", "branchless s", "timsort s", "ganho");
+    for (kind = 0; kind < 5; kind++) {
+        fill(input, n, kind);
+        tins = n <= INSERTION_MAX ? run(insertionsort, input, work, n) : -1;
+        tintro = run(introsort, input, work, n);
+        tbl = run(branchlessintrosort, input, work, n);
+        ttim = run(timsort, input, work, n);
+
+        // Acentos ocupam dois bytes em UTF-8.
+        printf("%-*s ", kind == 4 ? 13 : 12, names[kind]);
+        if (tins < 0) printf("%12s ", "-");
+        else printf("%12.5f ", tins);
+        printf("%12.5f %12.5f %12.5f %8.2fx\n", tintro, tbl, ttim, (tintro < tbl ? tintro : tbl) / ttim);
+    }
+    printf("\n");
+
+    free(input);
+    free(work);
+}
+
+int main(int argc, char **argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 5000000;
+
+    srand(42);
+    table(n < INSERTION_MAX ? n : INSERTION_MAX);
+    if (n > INSERTION_MAX) table(n);
+    return 0;
+}
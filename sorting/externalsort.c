@@ -0,0 +1,230 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef EXTERNALSORT_C
+#define EXTERNALSORT_C
+
+// Usa fseeko e off_t, para arquivos maiores que 2 GB: defina
+// _POSIX_C_SOURCE 200809L antes de qualquer #include.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <sys/types.h>
+#include "introsort.c"
+
+// Menor buffer de leitura por sequência na intercalação, em ints.
+// Com pouca memória o fan-in é reduzido para respeitar o mínimo.
+#ifndef EXTERNALSORT_MINBUF
+#define EXTERNALSORT_MINBUF 4096
+#endif
+
+/**
+ * Sequência ordenada em um arquivo temporário, em ints.
+ */
+typedef struct {
+    off_t start, count;
+} RunExternal;
+
+/**
+ * Leitor bufferizado de uma sequência.
+ */
+typedef struct {
+    off_t pos, end;
+    int *buf;
+    int len, idx;
+} ReaderExternal;
+
+/**
+ * Recarrega o buffer de um leitor.
+ * 
+ * @return int 1 se leu, 0 no fim da sequência, -1 em erro.
+ */
+static int refillexternal(FILE *f, ReaderExternal *r, int cap) {
+    size_t want;
+
+    r->idx = r->len = 0;
+    if (r->pos >= r->end) return 0;
+
+    want = r->end - r->pos < cap ? (size_t) (r->end - r->pos) : (size_t) cap;
+    if (fseeko(f, r->pos * (off_t) sizeof(int), SEEK_SET) != 0) return -1;
+    if (fread(r->buf, sizeof(int), want, f) != want) return -1;
+    r->pos += want;
+    r->len = (int) want;
+    return 1;
+}
+
+/**
+ * Refaz o caminho da folha s até a raiz da árvore de perdedores.
+ * 
+ * Cada nó interno guarda o perdedor da disputa; o vencedor sobe e
+ * termina em tree[0]. key tem o próximo valor de cada sequência,
+ * LLONG_MAX para as esgotadas e LLONG_MIN para a folha virtual k,
+ * que vence todas e é usada apenas na construção.
+ */
+static void adjustexternal(const long long *key, int *tree, int k, int s) {
+    int t, tmp;
+
+    for (t = (s + k) / 2; t > 0; t /= 2) {
+        if (key[tree[t]] < key[s]) {
+            tmp = s;
+            s = tree[t];
+            tree[t] = tmp;
+        }
+    }
+    tree[0] = s;
+}
+
+/**
+ * Intercala k sequências de in e grava o resultado em out.
+ * 
+ * @param in arquivo com as sequências.
+ * @param runs vetor com as k sequências.
+ * @param k quantidade de sequências (maior que zero).
+ * @param out arquivo de saída, gravado a partir da posição atual.
+ * @param mem área com (k + 1) * bufints ints.
+ * @param bufints tamanho de cada buffer.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+static int mergeexternal(FILE *in, RunExternal *runs, int k, FILE *out, int *mem, int bufints) {
+    ReaderExternal *r;
+    long long *key;
+    int *tree, *obuf = mem + (size_t) k * bufints;
+    int i, w, got, olen = 0, ok = 0;
+
+    if (k < 1) return 0;
+
+    r = (ReaderExternal *) malloc(k * sizeof(ReaderExternal));
+    key = (long long *) malloc((k + 1) * sizeof(long long));
+    tree = (int *) malloc(k * sizeof(int));
+    if (!r || !key || !tree) goto end;
+
+    for (i = 0; i < k; i++) {
+        r[i].pos = runs[i].start;
+        r[i].end = runs[i].start + runs[i].count;
+        r[i].buf = mem + (size_t) i * bufints;
+        if ((got = refillexternal(in, &r[i], bufints)) < 0) goto end;
+        key[i] = got ? r[i].buf[0] : LLONG_MAX;
+        tree[i] = k;
+    }
+    key[k] = LLONG_MIN;
+    for (i = k - 1; i >= 0; i--) adjustexternal(key, tree, k, i);
+
+    for (w = tree[0]; key[w] != LLONG_MAX; w = tree[0]) {
+        obuf[olen++] = (int) key[w];
+        if (olen == bufints) {
+            if (fwrite(obuf, sizeof(int), olen, out) != (size_t) olen) goto end;
+            olen = 0;
+        }
+        if (++r[w].idx < r[w].len) key[w] = r[w].buf[r[w].idx];
+        else {
+            if ((got = refillexternal(in, &r[w], bufints)) < 0) goto end;
+            key[w] = got ? r[w].buf[0] : LLONG_MAX;
+        }
+        adjustexternal(key, tree, k, w);
+    }
+    ok = fwrite(obuf, sizeof(int), olen, out) == (size_t) olen;
+
+end:
+    free(r);
+    free(key);
+    free(tree);
+    return ok;
+}
+
+/**
+ * Ordena arquivo binário de ints maior que a memória.
+ * 
+ * Lê o arquivo em sequências do tamanho do orçamento de memória,
+ * ordena cada uma com introsort e grava em um arquivo temporário.
+ * Depois intercala até fanin sequências por vez com uma árvore de
+ * perdedores, usando um buffer de leitura por sequência e um de
+ * escrita, todos dentro do orçamento, repetindo as passadas até
+ * que a última grave o arquivo de saída. Todas as leituras e
+ * escritas são sequenciais em blocos grandes. Os ints estão na
+ * ordem de bytes da máquina.
+ * 
+ * @param input caminho do arquivo a ordenar.
+ * @param output caminho do arquivo ordenado (sobrescrito).
+ * @param memory orçamento de memória em bytes.
+ * @param fanin máximo de sequências por intercalação (>= 2).
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int externalsort(const char *input, const char *output, size_t memory, int fanin) {
+    FILE *in = NULL, *out = NULL, *tmp = NULL, *next;
+    RunExternal *runs = NULL, *grown, run;
+    int *mem = NULL;
+    size_t runints, got;
+    off_t total = 0;
+    int bufints, nruns = 0, capruns = 0, nmerged, i, j, k, ok = 0;
+
+    if (!input || !output || fanin < 2) return 0;
+
+    runints = memory / sizeof(int);
+    if (runints > INT_MAX) runints = INT_MAX;
+    if (runints / (fanin + 1) < EXTERNALSORT_MINBUF) fanin = (int) (runints / EXTERNALSORT_MINBUF) - 1;
+    if (fanin < 2) return 0;
+    bufints = (int) (runints / (fanin + 1));
+
+    mem = (int *) malloc(runints * sizeof(int));
+    in = fopen(input, "rb");
+    tmp = tmpfile();
+    if (!mem || !in || !tmp) goto end;
+
+    // Sequências iniciais do tamanho da memória.
+    while ((got = fread(mem, sizeof(int), runints, in)) > 0) {
+        branchlessintrosort(mem, (int) got);
+        if (fwrite(mem, sizeof(int), got, tmp) != got) goto end;
+        if (nruns == capruns) {
+            capruns = capruns ? 2 * capruns : 16;
+            grown = (RunExternal *) realloc(runs, capruns * sizeof(RunExternal));
+            if (!grown) goto end;
+            runs = grown;
+        }
+        runs[nruns].start = total;
+        runs[nruns].count = (off_t) got;
+        total += (off_t) got;
+        nruns++;
+    }
+    if (ferror(in) || fflush(tmp) != 0) goto end;
+
+    // Passadas intermediárias até restarem no máximo fanin sequências.
+    while (nruns > fanin) {
+        next = tmpfile();
+        if (!next) goto end;
+        for (i = 0, nmerged = 0; i < nruns; i += fanin) {
+            k = nruns - i < fanin ? nruns - i : fanin;
+            run.start = runs[i].start;
+            for (j = 0, run.count = 0; j < k; j++) run.count += runs[i + j].count;
+            if (!mergeexternal(tmp, runs + i, k, next, mem, bufints)) {
+                fclose(next);
+                goto end;
+            }
+            runs[nmerged++] = run;
+        }
+        fclose(tmp);
+        tmp = next;
+        nruns = nmerged;
+        if (fflush(tmp) != 0) goto end;
+    }
+
+    out = fopen(output, "wb");
+    if (!out) goto end;
+    ok = nruns == 0 || mergeexternal(tmp, runs, nruns, out, mem, bufints);
+
+end:
+    if (in) fclose(in);
+    if (tmp) fclose(tmp);
+    if (out && fclose(out) != 0) ok = 0;
+    if (!ok && out) remove(output);
+    free(mem);
+    free(runs);
+    return ok;
+}
+
+#endif
@@ -0,0 +1,186 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef GENPARALLELSORT_H
+#define GENPARALLELSORT_H
+
+#include <stdlib.h>
+#include <string.h>
+#include "../threadpool/threadpool.h"
+
+// Compilar junto com threadpool/threadpool.c e -pthread.
+
+/**
+ * Merge sort paralelo gerado por macro.
+ * 
+ * Mesma convenção de gensort.h: less(a, b) recebe dois elementos
+ * do tipo e é expandida no código gerado. sortrun(arr, tmp, n)
+ * ordena um trecho de n elementos e pode usar tmp, de mesmo
+ * tamanho, como área auxiliar; com sortrun estável a ordenação
+ * inteira é estável, pois a intercalação preserva empates.
+ * 
+ * Cada thread do pool ordena um trecho e os trechos são
+ * intercalados aos pares, com cada intercalação dividida entre as
+ * threads livres por merge path: uma busca binária (co-rank) diz
+ * quantos elementos de cada lado entram nos k primeiros da
+ * intercalação, de forma que cada tarefa produz um trecho
+ * independente da saída.
+ * 
+ * A função gerada aguarda as tarefas com waitpool e não pode ser
+ * chamada de dentro de uma tarefa do mesmo pool: waitpool
+ * esperaria também pela tarefa chamadora e nunca retornaria.
+ */
+
+/**
+ * Gera int name(ThreadPool *pool, type *arr, type *tmp, int n).
+ * 
+ * Ordena arr usando tmp, com n elementos, como área auxiliar; o
+ * resultado fica em arr. Com pool NULL tudo é feito na thread
+ * chamadora. Retorna 1 para sucesso e 0 caso a alocação das
+ * tarefas falhe (arr inalterado).
+ * 
+ * @param name nome da função gerada.
+ * @param type tipo dos elementos.
+ * @param less comparação less(a, b).
+ * @param sortrun função void sortrun(type *arr, type *tmp, int n).
+ */
+#define DEFINEPARALLELSORT(name, type, less, sortrun)                                  \
+typedef struct {                                                                       \
+    type *src, *dst;                                                                   \
+    int lo, mid, hi;                                                                   \
+    int from, to;                                                                      \
+} name##jobgenparsort;                                                                 \
+                                                                                       \
+static void name##mergegenparsort(const type *a, int na, const type *b, int nb, type *out) { \
+    int i = 0, j = 0;                                                                  \
+                                                                                       \
+    while (i < na && j < nb) *out++ = less(b[j], a[i]) ? b[j++] : a[i++];              \
+    while (i < na) *out++ = a[i++];                                                    \
+    while (j < nb) *out++ = b[j++];                                                    \
+}                                                                                      \
+                                                                                       \
+static int name##corankgenparsort(const type *a, int na, const type *b, int nb, int k) { \
+    int lo = k > nb ? k - nb : 0, hi = k < na ? k : na, i;                             \
+                                                                                       \
+    while (lo < hi) {                                                                  \
+        i = (lo + hi) / 2;                                                             \
+        if (!less(b[k - i - 1], a[i])) lo = i + 1;                                     \
+        else hi = i;                                                                   \
+    }                                                                                  \
+    return lo;                                                                         \
+}                                                                                      \
+                                                                                       \
+static void name##rungenparsort(void *arg) {                                           \
+    name##jobgenparsort *job = (name##jobgenparsort *) arg;                            \
+                                                                                       \
+    sortrun(job->src + job->from, job->dst + job->from, job->to - job->from);          \
+}                                                                                      \
+                                                                                       \
+static void name##runmergegenparsort(void *arg) {                                      \
+    name##jobgenparsort *job = (name##jobgenparsort *) arg;                            \
+    type *a = job->src + job->lo, *b = job->src + job->mid;                            \
+    int na = job->mid - job->lo, nb = job->hi - job->mid;                              \
+    int i0, i1, k0 = job->from - job->lo, k1 = job->to - job->lo;                      \
+                                                                                       \
+    i0 = name##corankgenparsort(a, na, b, nb, k0);                                     \
+    i1 = name##corankgenparsort(a, na, b, nb, k1);                                     \
+    name##mergegenparsort(a + i0, i1 - i0, b + k0 - i0, k1 - i1 - (k0 - i0), job->dst + job->from); \
+}                                                                                      \
+                                                                                       \
+static void name##runcopygenparsort(void *arg) {                                       \
+    name##jobgenparsort *job = (name##jobgenparsort *) arg;                            \
+                                                                                       \
+    memcpy(job->dst + job->from, job->src + job->from, (job->to - job->from) * sizeof(type)); \
+}                                                                                      \
+                                                                                       \
+static void name##jobsgenparsort(ThreadPool *pool, void (*fn)(void *), name##jobgenparsort *jobs, int njobs) { \
+    int i;                                                                             \
+                                                                                       \
+    for (i = 0; i < njobs; i++) {                                                      \
+        if (!pool || !submitpool(pool, fn, &jobs[i])) fn(&jobs[i]);                    \
+    }                                                                                  \
+    waitpool(pool);                                                                    \
+}                                                                                      \
+                                                                                       \
+static int name(ThreadPool *pool, type *arr, type *tmp, int n) {                       \
+    name##jobgenparsort *jobs;                                                         \
+    type *src = arr, *dst = tmp, *swap;                                                \
+    int *bounds;                                                                       \
+    int i, j, p, nthreads, nruns, parts, njobs;                                        \
+                                                                                       \
+    if (n < 2) return 1;                                                               \
+    nthreads = pool ? lenpool(pool) : 1;                                               \
+    if (nthreads < 1) nthreads = 1;                                                    \
+    if (nthreads > n) nthreads = n;                                                    \
+                                                                                       \
+    jobs = (name##jobgenparsort *) malloc((nthreads + 1) * sizeof(name##jobgenparsort)); \
+    bounds = (int *) malloc((nthreads + 1) * sizeof(int));                             \
+    if (!jobs || !bounds) {                                                            \
+        free(jobs);                                                                    \
+        free(bounds);                                                                  \
+        return 0;                                                                      \
+    }                                                                                  \
+                                                                                       \
+    /* Um trecho ordenado por thread, no próprio vetor. */                             \
+    nruns = nthreads;                                                                  \
+    for (i = 0; i <= nruns; i++) bounds[i] = (int) ((long long) n * i / nruns);        \
+    for (i = 0; i < nruns; i++) {                                                      \
+        jobs[i].src = arr;                                                             \
+        jobs[i].dst = tmp;                                                             \
+        jobs[i].from = bounds[i];                                                      \
+        jobs[i].to = bounds[i + 1];                                                    \
+    }                                                                                  \
+    name##jobsgenparsort(pool, name##rungenparsort, jobs, nruns);                      \
+                                                                                       \
+    /* Intercala aos pares; cada par é dividido em partes iguais. */                   \
+    while (nruns > 1) {                                                                \
+        parts = nthreads / (nruns / 2);                                                \
+        for (i = 0, njobs = 0; i + 1 < nruns; i += 2) {                                \
+            for (p = 0; p < parts; p++, njobs++) {                                     \
+                jobs[njobs].src = src;                                                 \
+                jobs[njobs].dst = dst;                                                 \
+                jobs[njobs].lo = bounds[i];                                            \
+                jobs[njobs].mid = bounds[i + 1];                                       \
+                jobs[njobs].hi = bounds[i + 2];                                        \
+                jobs[njobs].from = bounds[i] + (int) ((long long) (bounds[i + 2] - bounds[i]) * p / parts); \
+                jobs[njobs].to = bounds[i] + (int) ((long long) (bounds[i + 2] - bounds[i]) * (p + 1) / parts); \
+            }                                                                          \
+        }                                                                              \
+        if (nruns % 2) {                                                               \
+            jobs[njobs].src = src;                                                     \
+            jobs[njobs].dst = dst;                                                     \
+            jobs[njobs].from = bounds[nruns - 1];                                      \
+            jobs[njobs].to = bounds[nruns];                                            \
+            name##runcopygenparsort(&jobs[njobs]);                                     \
+        }                                                                              \
+        name##jobsgenparsort(pool, name##runmergegenparsort, jobs, njobs);             \
+                                                                                       \
+        for (i = 0, j = 0; i < nruns; i += 2) bounds[++j] = bounds[i + 2 < nruns ? i + 2 : nruns]; \
+        nruns = j;                                                                     \
+        swap = src;                                                                    \
+        src = dst;                                                                     \
+        dst = swap;                                                                    \
+    }                                                                                  \
+                                                                                       \
+    /* Quantidade ímpar de rodadas: o resultado está em tmp. */                        \
+    if (src != arr) {                                                                  \
+        for (i = 0; i < nthreads; i++) {                                               \
+            jobs[i].src = tmp;                                                         \
+            jobs[i].dst = arr;                                                         \
+            jobs[i].from = (int) ((long long) n * i / nthreads);                       \
+            jobs[i].to = (int) ((long long) n * (i + 1) / nthreads);                   \
+        }                                                                              \
+        name##jobsgenparsort(pool, name##runcopygenparsort, jobs, nthreads);           \
+    }                                                                                  \
+                                                                                       \
+    free(jobs);                                                                        \
+    free(bounds);                                                                      \
+    return 1;                                                                          \
+}
+
+#endif
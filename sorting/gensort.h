@@ -0,0 +1,249 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef GENSORT_H
+#define GENSORT_H
+
+#include <stdlib.h>
+
+/**
+ * Ordenações genéricas geradas por macro.
+ * 
+ * Cada macro gera, para um tipo e uma comparação, uma função de
+ * ordenação especializada: a comparação é expandida no código
+ * gerado e não há chamada indireta por comparação, como em qsort.
+ * less(a, b) recebe dois elementos do tipo (não ponteiros) e
+ * retorna diferente de zero se a deve vir antes de b. Pode ser uma
+ * macro ou uma função static inline, e é nela que fica a extração
+ * da chave:
+ * 
+ *     typedef struct {
+ *         int id;
+ *         double score;
+ *     } Player;
+ * 
+ *     #define BYSCORE(a, b) ((a).score < (b).score)
+ *     DEFINESORT(sortplayers, Player, BYSCORE)
+ *     DEFINESTABLESORT(stablesortplayers, Player, BYSCORE)
+ * 
+ * As funções geradas são static, podendo ser instanciadas em
+ * vários arquivos.
+ */
+
+// Partições e blocos com até GENSORT_CUTOFF elementos são
+// ordenados com insertion sort.
+#ifndef GENSORT_CUTOFF
+#define GENSORT_CUTOFF 16
+#endif
+
+/**
+ * Gera void name(type *arr, int n): introsort não estável.
+ * 
+ * Quicksort com pivô por mediana de 3 (ninther em partições
+ * grandes) e particionamento de Hoare, heapsort quando a recursão
+ * passa de 2 log2(n) níveis e insertion sort nas partições
+ * pequenas. O(n log n) no pior caso, sem alocação.
+ * 
+ * @param name nome da função gerada.
+ * @param type tipo dos elementos.
+ * @param less comparação less(a, b).
+ */
+#define DEFINESORT(name, type, less)                                                   \
+static void name##insertiongensort(type *arr, int n) {                                 \
+    type key;                                                                          \
+    int i, j;                                                                          \
+                                                                                       \
+    for (i = 1; i < n; i++) {                                                          \
+        key = arr[i];                                                                  \
+        for (j = i; j > 0 && less(key, arr[j - 1]); j--) arr[j] = arr[j - 1];          \
+        arr[j] = key;                                                                  \
+    }                                                                                  \
+}                                                                                      \
+                                                                                       \
+DEFINESORTBASE(name, type, less, GENSORT_CUTOFF, name##insertiongensort)
+
+/**
+ * Gera void name(type *arr, int n): o introsort de DEFINESORT com
+ * outro caso base.
+ * 
+ * Partições com até cutoff elementos são ordenadas com
+ * basecase(arr, n) em vez de insertion sort; é assim que
+ * introsort.c aceita INTROSORT_BASECASE. Também gera
+ * name##pivotgensort(arr, lo, hi), que move o pivô de arr[lo..hi)
+ * para arr[lo], e name##heapgensort(arr, n), para variantes que
+ * trocam só o particionamento.
+ * 
+ * @param name nome da função gerada.
+ * @param type tipo dos elementos.
+ * @param less comparação less(a, b).
+ * @param cutoff tamanho máximo das partições do caso base.
+ * @param basecase função void basecase(type *arr, int n).
+ */
+#define DEFINESORTBASE(name, type, less, cutoff, basecase)                             \
+static inline void name##swapgensort(type *arr, int a, int b) {                        \
+    type tmp = arr[a];                                                                 \
+    arr[a] = arr[b];                                                                   \
+    arr[b] = tmp;                                                                      \
+}                                                                                      \
+                                                                                       \
+static int name##median3gensort(type *arr, int a, int b, int c) {                      \
+    if (less(arr[a], arr[b])) {                                                        \
+        if (less(arr[b], arr[c])) return b;                                            \
+        return less(arr[a], arr[c]) ? c : a;                                           \
+    }                                                                                  \
+    if (less(arr[a], arr[c])) return a;                                                \
+    return less(arr[b], arr[c]) ? c : b;                                               \
+}                                                                                      \
+                                                                                       \
+static void name##pivotgensort(type *arr, int lo, int hi) {                            \
+    int n = hi - lo, mid = lo + n / 2, s, p;                                           \
+                                                                                       \
+    if (n < 128) p = name##median3gensort(arr, lo, mid, hi - 1);                       \
+    else {                                                                             \
+        s = n / 8;                                                                     \
+        p = name##median3gensort(arr,                                                  \
+                name##median3gensort(arr, lo, lo + s, lo + 2 * s),                     \
+                name##median3gensort(arr, mid - s, mid, mid + s),                      \
+                name##median3gensort(arr, hi - 1 - 2 * s, hi - 1 - s, hi - 1));        \
+    }                                                                                  \
+    name##swapgensort(arr, lo, p);                                                     \
+}                                                                                      \
+                                                                                       \
+static void name##heapgensort(type *arr, int n) {                                      \
+    int i, end, root, child;                                                           \
+                                                                                       \
+    for (i = n / 2 - 1, end = n; end > 1; ) {                                          \
+        if (i >= 0) root = i--;                                                        \
+        else {                                                                         \
+            name##swapgensort(arr, 0, --end);                                          \
+            root = 0;                                                                  \
+        }                                                                              \
+        while ((child = 2 * root + 1) < end) {                                         \
+            if (child + 1 < end && less(arr[child], arr[child + 1])) child++;          \
+            if (!less(arr[root], arr[child])) break;                                   \
+            name##swapgensort(arr, root, child);                                       \
+            root = child;                                                              \
+        }                                                                              \
+    }                                                                                  \
+}                                                                                      \
+                                                                                       \
+static void name##loopgensort(type *arr, int lo, int hi, int depth) {                  \
+    type p;                                                                            \
+    int i, j;                                                                          \
+                                                                                       \
+    while (hi - lo > (cutoff)) {                                                       \
+        if (depth-- == 0) {                                                            \
+            name##heapgensort(arr + lo, hi - lo);                                      \
+            return;                                                                    \
+        }                                                                              \
+        name##pivotgensort(arr, lo, hi);                                               \
+                                                                                       \
+        p = arr[lo];                                                                   \
+        i = lo;                                                                        \
+        j = hi;                                                                        \
+        for (;;) {                                                                     \
+            do i++; while (i < hi && less(arr[i], p));                                 \
+            do j--; while (less(p, arr[j]));                                           \
+            if (i >= j) break;                                                         \
+            name##swapgensort(arr, i, j);                                              \
+        }                                                                              \
+        name##swapgensort(arr, lo, j);                                                 \
+                                                                                       \
+        if (j - lo < hi - j) {                                                         \
+            name##loopgensort(arr, lo, j, depth);                                      \
+            lo = j + 1;                                                                \
+        }                                                                              \
+        else {                                                                         \
+            name##loopgensort(arr, j + 1, hi, depth);                                  \
+            hi = j;                                                                    \
+        }                                                                              \
+    }                                                                                  \
+    basecase(arr + lo, hi - lo);                                                       \
+}                                                                                      \
+                                                                                       \
+static void name(type *arr, int n) {                                                   \
+    int depth = 0, m;                                                                  \
+                                                                                       \
+    for (m = n; m > 1; m >>= 1) depth += 2;                                            \
+    if (n > 1) name##loopgensort(arr, 0, n, depth);                                    \
+}
+
+/**
+ * Gera void name(type *arr, type *tmp, int n): merge sort estável
+ * com área auxiliar fornecida pelo chamador.
+ * 
+ * Insertion sort em blocos de GENSORT_CUTOFF elementos seguido de
+ * merge sort bottom-up alternando entre arr e tmp, que deve ter
+ * espaço para n elementos. Elementos equivalentes mantêm a ordem
+ * original; o resultado fica em arr. Não aloca memória, o que
+ * permite ordenar trechos de um vetor maior em paralelo (ver
+ * genparallelsort.h).
+ * 
+ * @param name nome da função gerada.
+ * @param type tipo dos elementos.
+ * @param less comparação less(a, b).
+ */
+#define DEFINESTABLESORTTMP(name, type, less)                                          \
+static void name##mergegensort(const type *a, int na, const type *b, int nb, type *out) { \
+    int i = 0, j = 0;                                                                  \
+                                                                                       \
+    while (i < na && j < nb) *out++ = less(b[j], a[i]) ? b[j++] : a[i++];              \
+    while (i < na) *out++ = a[i++];                                                    \
+    while (j < nb) *out++ = b[j++];                                                    \
+}                                                                                      \
+                                                                                       \
+static void name(type *arr, type *tmp, int n) {                                        \
+    type *src = arr, *dst = tmp, *swap, key;                                           \
+    int i, j, lo, w;                                                                   \
+                                                                                       \
+    for (lo = 0; lo < n; lo += GENSORT_CUTOFF) {                                       \
+        for (i = lo + 1; i < n && i < lo + GENSORT_CUTOFF; i++) {                      \
+            key = arr[i];                                                              \
+            for (j = i; j > lo && less(key, arr[j - 1]); j--) arr[j] = arr[j - 1];     \
+            arr[j] = key;                                                              \
+        }                                                                              \
+    }                                                                                  \
+    for (w = GENSORT_CUTOFF; w < n; w *= 2) {                                          \
+        for (lo = 0; lo < n; lo += 2 * w) {                                            \
+            i = lo + w < n ? lo + w : n;                                               \
+            j = lo + 2 * w < n ? lo + 2 * w : n;                                       \
+            name##mergegensort(src + lo, i - lo, src + i, j - i, dst + lo);            \
+        }                                                                              \
+        swap = src;                                                                    \
+        src = dst;                                                                     \
+        dst = swap;                                                                    \
+    }                                                                                  \
+    for (i = 0; src != arr && i < n; i++) arr[i] = src[i];                             \
+}
+
+/**
+ * Gera int name(type *arr, int n): merge sort estável.
+ * 
+ * Mesma ordenação de DEFINESTABLESORTTMP, alocando a área
+ * auxiliar de n elementos. Retorna 1 para sucesso e 0 caso a
+ * alocação falhe (vetor inalterado).
+ * 
+ * @param name nome da função gerada.
+ * @param type tipo dos elementos.
+ * @param less comparação less(a, b).
+ */
+#define DEFINESTABLESORT(name, type, less)                                             \
+DEFINESTABLESORTTMP(name##tmpgensort, type, less)                                      \
+                                                                                       \
+static int name(type *arr, int n) {                                                    \
+    type *tmp;                                                                         \
+                                                                                       \
+    if (n < 2) return 1;                                                               \
+    tmp = (type *) malloc(n * sizeof(type));                                           \
+    if (!tmp) return 0;                                                                \
+    name##tmpgensort(arr, tmp, n);                                                     \
+    free(tmp);                                                                         \
+    return 1;                                                                          \
+}
+
+#endif
@@ -7,6 +7,9 @@
  */
 
 
+#ifndef INSERTIONSORT_C
+#define INSERTIONSORT_C
+
 /**
  * Realiza ordenação de elementos em um vetor
  * 
@@ -27,4 +30,6 @@ void insertionsort(int *arr, int n) {
         }
         arr[j + 1] = key;
     }
-}
\ No newline at end of file
+}
+
+#endif
\ No newline at end of file
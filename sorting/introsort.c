@@ -0,0 +1,149 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef INTROSORT_C
+#define INTROSORT_C
+
+#include "insertionsort.c"
+#include "gensort.h"
+
+// Partições com até INTROSORT_CUTOFF elementos são finalizadas
+// com INTROSORT_BASECASE (por padrão insertionsort). Ambos podem
+// ser definidos antes de incluir este arquivo; veja simdsort.c.
+#ifndef INTROSORT_CUTOFF
+#define INTROSORT_CUTOFF 16
+#endif
+
+#ifndef INTROSORT_BASECASE
+#define INTROSORT_BASECASE insertionsort
+#endif
+
+#define LESSINTRO(a, b) ((a) < (b))
+
+// introsort é o DEFINESORT de gensort.h para int, com o caso base
+// configurável; a variante sem desvios reaproveita o pivô e o
+// heapsort gerados e troca só o particionamento.
+DEFINESORTBASE(sortintro, int, LESSINTRO, INTROSORT_CUTOFF, INTROSORT_BASECASE)
+
+/**
+ * Particiona arr[lo..hi) em torno do pivô arr[lo] sem desvios.
+ * 
+ * Cada elemento é trocado incondicionalmente com a fronteira,
+ * que avança pelo resultado da comparação (Lomuto sem desvios);
+ * o custo não depende de o desvio ser previsível. Com equal
+ * diferente de zero, os iguais ao pivô também vão para a
+ * esquerda.
+ * 
+ * @return int posição final do pivô.
+ */
+static int partitionblintro(int *arr, int lo, int hi, int equal) {
+    int p = arr[lo], i, j = lo + 1, x;
+
+    if (equal) {
+        for (i = lo + 1; i < hi; i++) {
+            x = arr[i];
+            arr[i] = arr[j];
+            arr[j] = x;
+            j += x <= p;
+        }
+    }
+    else {
+        for (i = lo + 1; i < hi; i++) {
+            x = arr[i];
+            arr[i] = arr[j];
+            arr[j] = x;
+            j += x < p;
+        }
+    }
+    sortintroswapgensort(arr, lo, j - 1);
+    return j - 1;
+}
+
+/**
+ * Laço do introsort sem desvios sobre arr[lo..hi).
+ * 
+ * Recursão na menor partição e iteração na maior, de modo que a
+ * pilha não passe de O(log n). Ao esgotar depth a partição é
+ * ordenada com heapsort.
+ */
+static void loopblintro(int *arr, int lo, int hi, int depth) {
+    int m;
+
+    while (hi - lo > INTROSORT_CUTOFF) {
+        if (depth-- == 0) {
+            sortintroheapgensort(arr + lo, hi - lo);
+            return;
+        }
+        sortintropivotgensort(arr, lo, hi);
+
+        // arr[lo - 1] não é maior que nenhum elemento da partição;
+        // se for igual ao pivô, a parte esquerda só tem iguais e
+        // já está pronta. Evita O(n^2) com muitos repetidos.
+        if (lo > 0 && arr[lo - 1] == arr[lo]) {
+            lo = partitionblintro(arr, lo, hi, 1) + 1;
+            continue;
+        }
+        m = partitionblintro(arr, lo, hi, 0);
+
+        if (m - lo < hi - m) {
+            loopblintro(arr, lo, m, depth);
+            lo = m + 1;
+        }
+        else {
+            loopblintro(arr, m + 1, hi, depth);
+            hi = m;
+        }
+    }
+    INTROSORT_BASECASE(arr + lo, hi - lo);
+}
+
+/**
+ * Limite de profundidade do introsort: 2 * log2(n).
+ */
+static int depthintro(int n) {
+    int depth = 0;
+
+    while (n > 1) {
+        n >>= 1;
+        depth += 2;
+    }
+    return depth;
+}
+
+/**
+ * Realiza ordenação de elementos em um vetor
+ * 
+ * Essa função realiza a ordenação dos elementos em um vetor
+ * utilizando o algoritmo Introsort: quicksort com pivô por
+ * mediana de 3 (ninther em partições grandes), heapsort quando a
+ * recursão passa de 2 log2(n) níveis e insertion sort nas
+ * partições pequenas. O(n log n) no pior caso.
+ * 
+ * @param arr int pointer contendo vetor
+ * @param n int do vetor arr
+ */
+void introsort(int *arr, int n) {
+    sortintro(arr, n);
+}
+
+/**
+ * Realiza ordenação de elementos em um vetor
+ * 
+ * Mesmo algoritmo de introsort, mas com particionamento sem
+ * desvios condicionais, mais rápido em dados aleatórios, onde o
+ * desvio da comparação com o pivô é imprevisível.
+ * 
+ * @param arr int pointer contendo vetor
+ * @param n int do vetor arr
+ */
+void branchlessintrosort(int *arr, int n) {
+    if (n < 2) return;
+    loopblintro(arr, 0, n, depthintro(n));
+}
+
+#endif
@@ -0,0 +1,94 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef PARALLELSORT_C
+#define PARALLELSORT_C
+
+#include <stdlib.h>
+#include "introsort.c"
+#include "genparallelsort.h"
+
+// Compilar junto com ../threadpool/threadpool.c e -pthread.
+
+// Vetores menores que PARALLELSORT_MIN são ordenados na thread
+// chamadora: criar threads custaria mais que a ordenação.
+#ifndef PARALLELSORT_MIN
+#define PARALLELSORT_MIN (1 << 16)
+#endif
+
+#define LESSPARALLELSORT(a, b) ((a) < (b))
+
+/**
+ * Ordena um trecho com introsort.
+ * 
+ * A área auxiliar não é usada: os trechos não precisam de
+ * ordenação estável, pois os valores são inteiros.
+ */
+static void runparallelsort(int *arr, int *tmp, int n) {
+    (void) tmp;
+    branchlessintrosort(arr, n);
+}
+
+DEFINEPARALLELSORT(mergeparallelsort, int, LESSPARALLELSORT, runparallelsort)
+
+/**
+ * Ordena com um pool já criado.
+ * 
+ * @return int 1 para sucesso, 0 caso a alocação falhe.
+ */
+static int poolparallelsort(ThreadPool *pool, int *arr, int n) {
+    int *tmp, ok;
+
+    tmp = (int *) malloc(n * sizeof(int));
+    if (!tmp) return 0;
+    ok = mergeparallelsort(pool, arr, tmp, n);
+    free(tmp);
+    return ok;
+}
+
+/**
+ * Realiza ordenação de elementos em um vetor
+ * 
+ * Essa função realiza a ordenação dos elementos em um vetor
+ * utilizando merge sort paralelo: cada thread ordena um trecho
+ * com introsort e os trechos são intercalados aos pares, com cada
+ * intercalação dividida entre as threads (merge path). Usa uma
+ * área auxiliar de n elementos. Vetores pequenos, um pool de uma
+ * thread ou falta de memória levam à ordenação sequencial.
+ * 
+ * @param arr int pointer contendo vetor
+ * @param n int do vetor arr
+ * @param nthreads int quantidade de threads, ou <= 0 para uma por processador
+ */
+void parallelsortthreads(int *arr, int n, int nthreads) {
+    ThreadPool *pool;
+
+    if (n < PARALLELSORT_MIN || nthreads == 1) {
+        branchlessintrosort(arr, n);
+        return;
+    }
+
+    pool = createpool(nthreads);
+    if (!pool || lenpool(pool) == 1 || !poolparallelsort(pool, arr, n)) branchlessintrosort(arr, n);
+    destroypool(pool);
+}
+
+/**
+ * Realiza ordenação de elementos em um vetor
+ * 
+ * Mesma ordenação de parallelsortthreads com uma thread por
+ * processador.
+ * 
+ * @param arr int pointer contendo vetor
+ * @param n int do vetor arr
+ */
+void parallelsort(int *arr, int n) {
+    parallelsortthreads(arr, n, 0);
+}
+
+#endif
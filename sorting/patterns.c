@@ -0,0 +1,95 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef PATTERNS_C
+#define PATTERNS_C
+
+#include <stdlib.h>
+
+// Padrões de entrada para os testes e benchmarks de ordenação.
+// Cada função preenche os n elementos de arr; as aleatórias usam
+// rand(), então o resultado depende de srand. Padrões que só
+// interessam a um algoritmo ficam no próprio teste.
+
+/**
+ * Valores aleatórios, negativos e positivos.
+ */
+void randompattern(int *arr, int n) {
+    int i;
+    for (i = 0; i < n; i++) arr[i] = rand() - RAND_MAX / 2;
+}
+
+/**
+ * Valores aleatórios entre lo e hi, inclusive; com intervalo
+ * pequeno, poucos valores distintos e muitos empates.
+ */
+void rangepattern(int *arr, int n, int lo, int hi) {
+    int i;
+    for (i = 0; i < n; i++) arr[i] = lo + rand() % (hi - lo + 1);
+}
+
+/**
+ * Vetor já ordenado: 0, 1, ..., n - 1.
+ */
+void sortedpattern(int *arr, int n) {
+    int i;
+    for (i = 0; i < n; i++) arr[i] = i;
+}
+
+/**
+ * Vetor em ordem decrescente: n, n - 1, ..., 1.
+ */
+void reversedpattern(int *arr, int n) {
+    int i;
+    for (i = 0; i < n; i++) arr[i] = n - i;
+}
+
+/**
+ * Todos os elementos iguais a value.
+ */
+void constpattern(int *arr, int n, int value) {
+    int i;
+    for (i = 0; i < n; i++) arr[i] = value;
+}
+
+/**
+ * "Órgão de tubos": crescente até a metade e depois decrescente.
+ */
+void organpattern(int *arr, int n) {
+    int i;
+    for (i = 0; i < n; i++) arr[i] = i < n / 2 ? i : n - i;
+}
+
+/**
+ * Quase ordenado: vetor ordenado com um elemento a cada step
+ * trocado com uma posição aleatória.
+ */
+void nearlysortedpattern(int *arr, int n, int step) {
+    int i, j, tmp;
+
+    sortedpattern(arr, n);
+    for (i = 0; i < n / step; i++) {
+        j = rand() % n;
+        tmp = arr[j];
+        arr[j] = arr[i * step];
+        arr[i * step] = tmp;
+    }
+}
+
+/**
+ * Registros anexados: vetor ordenado cujos últimos tail elementos
+ * são aleatórios entre 0 e n.
+ */
+void tailpattern(int *arr, int n, int tail) {
+    int i;
+
+    sortedpattern(arr, n);
+    for (i = n - tail; i < n; i++) arr[i] = rand() % (n + 1);
+}
+
+#endif
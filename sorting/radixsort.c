@@ -0,0 +1,101 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef RADIXSORT_C
+#define RADIXSORT_C
+
+#include <stdlib.h>
+#include "introsort.c"
+
+// Dígitos de 8 bits: quatro passadas com histogramas de 256
+// contadores, que cabem juntos na cache L1.
+#define RADIX_BITS 8
+#define RADIX_SIZE (1 << RADIX_BITS)
+#define RADIX_PASSES (32 / RADIX_BITS)
+
+/**
+ * Chave sem sinal com a mesma ordem de x.
+ * 
+ * Inverter o bit de sinal coloca os negativos antes dos positivos.
+ */
+static unsigned keyradix(int x) {
+    return (unsigned) x ^ 0x80000000u;
+}
+
+/**
+ * Realiza ordenação de elementos em um vetor
+ * 
+ * Versão de radixsort que usa tmp como área auxiliar, evitando
+ * alocação. Os histogramas de todos os dígitos são calculados em
+ * uma única passada inicial e as passadas em que todos os
+ * elementos têm o mesmo dígito são puladas.
+ * 
+ * @param arr int pointer contendo vetor
+ * @param n int do vetor arr
+ * @param tmp int pointer para área auxiliar com n elementos
+ */
+void radixsortbuf(int *arr, int n, int *tmp) {
+    static const int shifts[RADIX_PASSES] = { 0, 8, 16, 24 };
+    int count[RADIX_PASSES][RADIX_SIZE] = { { 0 } };
+    int *src = arr, *dst = tmp, *swap;
+    int i, d, sum, c;
+    unsigned key;
+
+    if (n < 2) return;
+
+    for (i = 0; i < n; i++) {
+        key = keyradix(arr[i]);
+        for (d = 0; d < RADIX_PASSES; d++) count[d][(key >> shifts[d]) & (RADIX_SIZE - 1)]++;
+    }
+
+    for (d = 0; d < RADIX_PASSES; d++) {
+        // Todos com o mesmo dígito: a passada não mudaria nada.
+        if (count[d][(keyradix(arr[0]) >> shifts[d]) & (RADIX_SIZE - 1)] == n) continue;
+
+        // Contagens viram posições iniciais de cada dígito.
+        for (i = 0, sum = 0; i < RADIX_SIZE; i++) {
+            c = count[d][i];
+            count[d][i] = sum;
+            sum += c;
+        }
+        for (i = 0; i < n; i++) {
+            dst[count[d][(keyradix(src[i]) >> shifts[d]) & (RADIX_SIZE - 1)]++] = src[i];
+        }
+        swap = src;
+        src = dst;
+        dst = swap;
+    }
+    for (i = 0; src != arr && i < n; i++) arr[i] = src[i];
+}
+
+/**
+ * Realiza ordenação de elementos em um vetor
+ * 
+ * Essa função realiza a ordenação dos elementos em um vetor
+ * utilizando o algoritmo Radix Sort LSD com dígitos de 8 bits,
+ * em tempo O(n). Aloca uma área auxiliar de n elementos; caso a
+ * alocação falhe, ordena com introsort.
+ * 
+ * @param arr int pointer contendo vetor
+ * @param n int do vetor arr
+ */
+void radixsort(int *arr, int n) {
+    int *tmp;
+
+    if (n < 2) return;
+
+    tmp = (int *) malloc(n * sizeof(int));
+    if (!tmp) {
+        branchlessintrosort(arr, n);
+        return;
+    }
+    radixsortbuf(arr, n, tmp);
+    free(tmp);
+}
+
+#endif
@@ -0,0 +1,301 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef SIMDSORT_C
+#define SIMDSORT_C
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "insertionsort.c"
+
+// Kernels vetoriais apenas em x86 com gcc/clang; a escolha entre
+// AVX2, SSE4.1 e a versão escalar é feita em tempo de execução,
+// sem exigir -mavx2 na compilação.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMDSORT_X86
+#include <immintrin.h>
+#endif
+
+// Vetores com até SIMDSORT_STACK elementos usam áreas auxiliares
+// na pilha; os maiores alocam.
+#ifndef SIMDSORT_STACK
+#define SIMDSORT_STACK 512
+#endif
+
+/**
+ * Kernel de ordenação.
+ * 
+ * sortblock ordena width elementos; merge intercala duas
+ * sequências ordenadas cujos tamanhos são múltiplos de width.
+ */
+typedef struct {
+    int width;
+    void (*sortblock)(int *);
+    void (*merge)(const int *, int, const int *, int, int *);
+    const char *name;
+} KernelSimd;
+
+static void sortblockscalar(int *p) {
+    insertionsort(p, 8);
+}
+
+static void mergescalar(const int *a, int na, const int *b, int nb, int *out) {
+    int i = 0, j = 0;
+
+    while (i < na && j < nb) *out++ = b[j] < a[i] ? b[j++] : a[i++];
+    while (i < na) *out++ = a[i++];
+    while (j < nb) *out++ = b[j++];
+}
+
+static const KernelSimd scalarsimd = { 8, sortblockscalar, mergescalar, "escalar" };
+
+#ifdef SIMDSORT_X86
+
+/**
+ * Comparador entre pares de faixas de um registro AVX2.
+ * 
+ * Cada faixa i é comparada com a faixa perm[i]; as faixas com bit
+ * em mask ficam com o maior valor do par, as demais com o menor.
+ */
+#define LAYERAVX2(v, mask, p0, p1, p2, p3, p4, p5, p6, p7) do {                            \
+    __m256i p_ = _mm256_permutevar8x32_epi32((v), _mm256_setr_epi32(p0, p1, p2, p3, p4, p5, p6, p7)); \
+    (v) = _mm256_blend_epi32(_mm256_min_epi32((v), p_), _mm256_max_epi32((v), p_), (mask)); \
+} while (0)
+
+/**
+ * Ordena as 8 faixas de um registro.
+ * 
+ * Rede de ordenação ótima de 19 comparadores em 6 camadas.
+ */
+__attribute__((target("avx2")))
+static inline __m256i sort8avx2(__m256i v) {
+    LAYERAVX2(v, 0xCC, 2, 3, 0, 1, 6, 7, 4, 5);
+    LAYERAVX2(v, 0xF0, 4, 5, 6, 7, 0, 1, 2, 3);
+    LAYERAVX2(v, 0xAA, 1, 0, 3, 2, 5, 4, 7, 6);
+    LAYERAVX2(v, 0x30, 0, 1, 4, 5, 2, 3, 6, 7);
+    LAYERAVX2(v, 0x50, 0, 4, 2, 6, 1, 5, 3, 7);
+    LAYERAVX2(v, 0x54, 0, 2, 1, 4, 3, 6, 5, 7);
+    return v;
+}
+
+/**
+ * Ordena um registro bitônico (distâncias 4, 2 e 1).
+ */
+__attribute__((target("avx2")))
+static inline __m256i cleanavx2(__m256i v) {
+    LAYERAVX2(v, 0xF0, 4, 5, 6, 7, 0, 1, 2, 3);
+    LAYERAVX2(v, 0xCC, 2, 3, 0, 1, 6, 7, 4, 5);
+    LAYERAVX2(v, 0xAA, 1, 0, 3, 2, 5, 4, 7, 6);
+    return v;
+}
+
+/**
+ * Intercalação bitônica de dois registros ordenados.
+ * 
+ * Ao final lo tem os 8 menores e hi os 8 maiores, ambos ordenados.
+ */
+__attribute__((target("avx2")))
+static inline void merge16avx2(__m256i *lo, __m256i *hi) {
+    __m256i b = _mm256_permutevar8x32_epi32(*hi, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+    __m256i mn = _mm256_min_epi32(*lo, b), mx = _mm256_max_epi32(*lo, b);
+
+    *lo = cleanavx2(mn);
+    *hi = cleanavx2(mx);
+}
+
+__attribute__((target("avx2")))
+static void sortblockavx2(int *p) {
+    _mm256_storeu_si256((__m256i *) p, sort8avx2(_mm256_loadu_si256((const __m256i *) p)));
+}
+
+/**
+ * Intercala a e b de 8 em 8 elementos.
+ * 
+ * Mantém no registro hi os 8 maiores já vistos e carrega o
+ * próximo bloco da sequência cujo próximo elemento é menor.
+ */
+__attribute__((target("avx2")))
+static void mergeavx2(const int *a, int na, const int *b, int nb, int *out) {
+    __m256i lo = _mm256_loadu_si256((const __m256i *) a), hi = _mm256_loadu_si256((const __m256i *) b);
+    int i = 8, j = 8;
+
+    for (;;) {
+        merge16avx2(&lo, &hi);
+        _mm256_storeu_si256((__m256i *) out, lo);
+        out += 8;
+        if (i < na && (j >= nb || a[i] <= b[j])) {
+            lo = _mm256_loadu_si256((const __m256i *) (a + i));
+            i += 8;
+        }
+        else if (j < nb) {
+            lo = _mm256_loadu_si256((const __m256i *) (b + j));
+            j += 8;
+        }
+        else break;
+    }
+    _mm256_storeu_si256((__m256i *) out, hi);
+}
+
+static const KernelSimd avx2simd = { 8, sortblockavx2, mergeavx2, "avx2" };
+
+/**
+ * Comparador entre pares de faixas de um registro SSE.
+ * 
+ * shuf é o imediato de _mm_shuffle_epi32 que leva cada faixa ao
+ * seu par; mask é o imediato de _mm_blend_epi16 (dois bits por
+ * faixa) das faixas que ficam com o maior valor.
+ */
+#define LAYERSSE41(v, shuf, mask) do {                                                   \
+    __m128i p_ = _mm_shuffle_epi32((v), (shuf));                                         \
+    (v) = _mm_blend_epi16(_mm_min_epi32((v), p_), _mm_max_epi32((v), p_), (mask));       \
+} while (0)
+
+__attribute__((target("sse4.1")))
+static inline __m128i sort4sse41(__m128i v) {
+    LAYERSSE41(v, _MM_SHUFFLE(2, 3, 0, 1), 0xCC);
+    LAYERSSE41(v, _MM_SHUFFLE(1, 0, 3, 2), 0xF0);
+    LAYERSSE41(v, _MM_SHUFFLE(3, 1, 2, 0), 0x30);
+    return v;
+}
+
+__attribute__((target("sse4.1")))
+static inline void merge8sse41(__m128i *lo, __m128i *hi) {
+    __m128i b = _mm_shuffle_epi32(*hi, _MM_SHUFFLE(0, 1, 2, 3));
+    __m128i mn = _mm_min_epi32(*lo, b), mx = _mm_max_epi32(*lo, b);
+
+    LAYERSSE41(mn, _MM_SHUFFLE(1, 0, 3, 2), 0xF0);
+    LAYERSSE41(mn, _MM_SHUFFLE(2, 3, 0, 1), 0xCC);
+    LAYERSSE41(mx, _MM_SHUFFLE(1, 0, 3, 2), 0xF0);
+    LAYERSSE41(mx, _MM_SHUFFLE(2, 3, 0, 1), 0xCC);
+    *lo = mn;
+    *hi = mx;
+}
+
+__attribute__((target("sse4.1")))
+static void sortblocksse41(int *p) {
+    _mm_storeu_si128((__m128i *) p, sort4sse41(_mm_loadu_si128((const __m128i *) p)));
+}
+
+__attribute__((target("sse4.1")))
+static void mergesse41(const int *a, int na, const int *b, int nb, int *out) {
+    __m128i lo = _mm_loadu_si128((const __m128i *) a), hi = _mm_loadu_si128((const __m128i *) b);
+    int i = 4, j = 4;
+
+    for (;;) {
+        merge8sse41(&lo, &hi);
+        _mm_storeu_si128((__m128i *) out, lo);
+        out += 4;
+        if (i < na && (j >= nb || a[i] <= b[j])) {
+            lo = _mm_loadu_si128((const __m128i *) (a + i));
+            i += 4;
+        }
+        else if (j < nb) {
+            lo = _mm_loadu_si128((const __m128i *) (b + j));
+            j += 4;
+        }
+        else break;
+    }
+    _mm_storeu_si128((__m128i *) out, hi);
+}
+
+static const KernelSimd sse41simd = { 4, sortblocksse41, mergesse41, "sse4.1" };
+
+#endif
+
+/**
+ * Kernel mais rápido suportado pelo processador.
+ */
+static const KernelSimd *kernelsimd() {
+#ifdef SIMDSORT_X86
+    if (__builtin_cpu_supports("avx2")) return &avx2simd;
+    if (__builtin_cpu_supports("sse4.1")) return &sse41simd;
+#endif
+    return &scalarsimd;
+}
+
+/**
+ * Ordena com um kernel específico.
+ * 
+ * Copia o vetor para uma área auxiliar completando com INT_MAX
+ * até um múltiplo da largura, ordena cada bloco com a rede,
+ * intercala os blocos aos pares (merge sort bottom-up) e copia os
+ * n menores de volta.
+ * 
+ * @return int 1 para sucesso, 0 caso a alocação falhe.
+ */
+static int sortkernelsimd(const KernelSimd *k, int *arr, int n) {
+    int stack[2 * SIMDSORT_STACK];
+    int *src, *dst, *swap, *buf = stack;
+    int i, m, w, lo, mid, hi;
+
+    m = (n + k->width - 1) / k->width * k->width;
+    if (m > SIMDSORT_STACK) {
+        buf = (int *) malloc(2 * (size_t) m * sizeof(int));
+        if (!buf) return 0;
+    }
+    src = buf;
+    dst = buf + m;
+
+    memcpy(src, arr, n * sizeof(int));
+    for (i = n; i < m; i++) src[i] = INT_MAX;
+    for (i = 0; i < m; i += k->width) k->sortblock(src + i);
+
+    for (w = k->width; w < m; w *= 2) {
+        for (lo = 0; lo < m; lo += 2 * w) {
+            mid = lo + w < m ? lo + w : m;
+            hi = lo + 2 * w < m ? lo + 2 * w : m;
+            if (mid == hi) memcpy(dst + lo, src + lo, (hi - lo) * sizeof(int));
+            else k->merge(src + lo, mid - lo, src + mid, hi - mid, dst + lo);
+        }
+        swap = src;
+        src = dst;
+        dst = swap;
+    }
+    memcpy(arr, src, n * sizeof(int));
+
+    if (buf != stack) free(buf);
+    return 1;
+}
+
+/**
+ * Realiza ordenação de elementos em um vetor
+ * 
+ * Essa função realiza a ordenação dos elementos em um vetor
+ * utilizando redes de ordenação em registros SIMD para blocos
+ * de 8 (AVX2) ou 4 (SSE4.1) elementos e intercalação bitônica
+ * vetorizada dos blocos, com o conjunto de instruções escolhido
+ * em tempo de execução. Feita para vetores pequenos (dezenas a
+ * centenas de elementos), inclusive como caso base de introsort:
+ * 
+ *     #include "simdsort.c"
+ *     #define INTROSORT_BASECASE simdsort
+ *     #define INTROSORT_CUTOFF 64
+ *     #include "introsort.c"
+ * 
+ * Vetores com mais de SIMDSORT_STACK elementos alocam área
+ * auxiliar; caso a alocação falhe, ordena com insertion sort.
+ * 
+ * @param arr int pointer contendo vetor
+ * @param n int do vetor arr
+ */
+void simdsort(int *arr, int n) {
+    if (n < 2) return;
+    if (!sortkernelsimd(kernelsimd(), arr, n)) insertionsort(arr, n);
+}
+
+/**
+ * Conjunto de instruções usado por simdsort.
+ * 
+ * @return const char* "avx2", "sse4.1" ou "escalar".
+ */
+const char *simdsortisa() {
+    return kernelsimd()->name;
+}
+
+#endif
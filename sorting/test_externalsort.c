@@ -0,0 +1,66 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "externalsort.c"
+
+#define INPUT "test_externalsort.in"
+#define OUTPUT "test_externalsort.out"
+
+// Grava n ints aleatórios, ordena o arquivo e compara com introsort.
+int check(int n, size_t memory, int fanin) {
+    int *arr = (int *) malloc((n + 1) * sizeof(int));
+    int *sorted = (int *) malloc((n + 1) * sizeof(int));
+    FILE *f;
+    int i, ok;
+
+    for (i = 0; i < n; i++) arr[i] = rand() - RAND_MAX / 2;
+    f = fopen(INPUT, "wb");
+    fwrite(arr, sizeof(int), n, f);
+    fclose(f);
+
+    ok = externalsort(INPUT, OUTPUT, memory, fanin);
+    introsort(arr, n);
+
+    f = fopen(OUTPUT, "rb");
+    ok = ok && f && fread(sorted, sizeof(int), n + 1, f) == (size_t) n && !memcmp(arr, sorted, n * sizeof(int));
+    if (f) fclose(f);
+
+    free(arr);
+    free(sorted);
+    remove(INPUT);
+    remove(OUTPUT);
+    return ok;
+}
+
+int main() {
+    srand(42);
+
+    // Arquivo vazio e arquivo que cabe na memória.
+    // Output: vazio: 1, uma sequência: 1
+    printf("vazio: %d, uma sequência: %d\n", check(0, 1 << 20, 8), check(1000, 1 << 20, 8));
+
+    // 1M ints com 256 KB (16 sequências) e fan-in 4: duas passadas
+    // intermediárias e a final.
+    // Output: várias passadas: 1
+    printf("várias passadas: %d\n", check(1000000, 256 << 10, 4));
+
+    // Tamanho não múltiplo do orçamento e fan-in maior que as sequências.
+    // Output: sequência final curta: 1
+    printf("sequência final curta: %d\n", check(777777, 200 << 10, 64));
+
+    // Orçamento pequeno demais para dois buffers mínimos.
+    // Output: memória insuficiente: 0
+    printf("memória insuficiente: %d\n", externalsort(INPUT, OUTPUT, 1024, 2));
+    return 0;
+}
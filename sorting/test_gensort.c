@@ -0,0 +1,88 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gensort.h"
+#include "introsort.c"
+
+typedef struct {
+    int key;
+    int index;
+} Record;
+
+#define LESSNUM(a, b) ((a) < (b))
+#define BYKEY(a, b) ((a).key < (b).key)
+
+DEFINESORT(sortint, int, LESSNUM)
+DEFINESORT(sortdouble, double, LESSNUM)
+DEFINESORT(sortrecord, Record, BYKEY)
+DEFINESTABLESORT(stablesortint, int, LESSNUM)
+DEFINESTABLESORT(stablesortrecord, Record, BYKEY)
+
+int main() {
+    int sizes[] = { 0, 1, 2, 16, 17, 200, 5000, 100000 };
+    int *arr, *copy, *expected;
+    double *darr;
+    Record *rec, *stable;
+    int s, i, n, failed = 0;
+
+    srand(42);
+    for (s = 0; s < (int) (sizeof(sizes) / sizeof(sizes[0])); s++) {
+        n = sizes[s];
+        arr = (int *) malloc((n + 1) * sizeof(int));
+        copy = (int *) malloc((n + 1) * sizeof(int));
+        expected = (int *) malloc((n + 1) * sizeof(int));
+        darr = (double *) malloc((n + 1) * sizeof(double));
+        rec = (Record *) malloc((n + 1) * sizeof(Record));
+        stable = (Record *) malloc((n + 1) * sizeof(Record));
+
+        // int: mesmo resultado de introsort.
+        for (i = 0; i < n; i++) expected[i] = rand() % (s + 1) * 1000 - rand() % 500;
+        memcpy(arr, expected, n * sizeof(int));
+        memcpy(copy, expected, n * sizeof(int));
+        introsort(expected, n);
+        sortint(arr, n);
+        stablesortint(copy, n);
+        failed += memcmp(arr, expected, n * sizeof(int)) != 0;
+        failed += memcmp(copy, expected, n * sizeof(int)) != 0;
+
+        // double: convertidos dos ints, mesma ordem.
+        for (i = 0; i < n; i++) darr[i] = expected[(i * 7919) % n] / 3.0;
+        sortdouble(darr, n);
+        for (i = 0; i < n; i++) failed += darr[i] != expected[i] / 3.0;
+
+        // Registros com chaves repetidas: a versão estável mantém a
+        // ordem dos índices entre chaves iguais.
+        for (i = 0; i < n; i++) {
+            rec[i].key = rand() % 10;
+            rec[i].index = i;
+        }
+        memcpy(stable, rec, n * sizeof(Record));
+        sortrecord(rec, n);
+        if (!stablesortrecord(stable, n)) failed++;
+        for (i = 1; i < n; i++) {
+            failed += rec[i - 1].key > rec[i].key;
+            failed += stable[i - 1].key > stable[i].key;
+            failed += stable[i - 1].key == stable[i].key && stable[i - 1].index > stable[i].index;
+        }
+
+        free(arr);
+        free(copy);
+        free(expected);
+        free(darr);
+        free(rec);
+        free(stable);
+    }
+
+    // Output: 0 divergências
+    printf("%d divergências\n", failed);
+    return failed != 0;
+}
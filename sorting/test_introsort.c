@@ -0,0 +1,72 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "introsort.c"
+#include "bubblesort.c"
+#include "selectionsort.c"
+#include "patterns.c"
+
+// Preenche o vetor com um padrão de entrada.
+void fill(int *arr, int n, int kind) {
+    switch (kind) {
+        case 0: randompattern(arr, n); break;
+        case 1: rangepattern(arr, n, 0, 3); break;
+        case 2: sortedpattern(arr, n); break;
+        case 3: reversedpattern(arr, n); break;
+        case 4: constpattern(arr, n, 7); break;
+        default: organpattern(arr, n);
+    }
+}
+
+// Compara introsort e branchlessintrosort com as ordenações
+// quadráticas em vetores de vários tamanhos e padrões.
+int main() {
+    int sizes[] = { 0, 1, 2, 3, 16, 17, 100, 129, 1000, 2500 };
+    int *arr, *expected, *other;
+    int s, kind, n, round, failed = 0, checked = 0;
+
+    srand(42);
+    for (s = 0; s < (int) (sizeof(sizes) / sizeof(sizes[0])); s++) {
+        n = sizes[s];
+        arr = (int *) malloc((n + 1) * sizeof(int));
+        expected = (int *) malloc((n + 1) * sizeof(int));
+        other = (int *) malloc((n + 1) * sizeof(int));
+
+        for (kind = 0; kind < 6; kind++) {
+            for (round = 0; round < 3; round++) {
+                fill(expected, n, kind);
+                memcpy(arr, expected, n * sizeof(int));
+                memcpy(other, expected, n * sizeof(int));
+
+                // Cada rodada usa uma ordenação quadrática diferente.
+                if (round == 0) bubblesort(expected, n);
+                else if (round == 1) insertionsort(expected, n);
+                else selectionsort(expected, n);
+
+                introsort(arr, n);
+                branchlessintrosort(other, n);
+                if (memcmp(arr, expected, n * sizeof(int)) || memcmp(other, expected, n * sizeof(int))) {
+                    printf("divergência: n = %d, padrão %d\n", n, kind);
+                    failed++;
+                }
+                checked++;
+            }
+        }
+        free(arr);
+        free(expected);
+        free(other);
+    }
+
+    // Output: 180 casos, 0 divergências
+    printf("%d casos, %d divergências\n", checked, failed);
+    return failed != 0;
+}
@@ -0,0 +1,49 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parallelsort.c"
+
+// Compilar com:
+//   gcc test_parallelsort.c ../threadpool/threadpool.c -pthread
+
+// Compara parallelsortthreads com introsort para várias
+// quantidades de threads, abaixo e acima de PARALLELSORT_MIN.
+int main() {
+    int sizes[] = { 0, 1, 1000, PARALLELSORT_MIN, PARALLELSORT_MIN + 1, 1000003 };
+    int *arr, *expected;
+    int s, i, n, nthreads, failed = 0, checked = 0;
+
+    srand(42);
+    for (s = 0; s < (int) (sizeof(sizes) / sizeof(sizes[0])); s++) {
+        n = sizes[s];
+        arr = (int *) malloc((n + 1) * sizeof(int));
+        expected = (int *) malloc((n + 1) * sizeof(int));
+
+        for (nthreads = 0; nthreads <= 7; nthreads++) {
+            for (i = 0; i < n; i++) expected[i] = nthreads % 2 ? rand() % 100 : rand() - RAND_MAX / 2;
+            memcpy(arr, expected, n * sizeof(int));
+            introsort(expected, n);
+            parallelsortthreads(arr, n, nthreads);
+            if (memcmp(arr, expected, n * sizeof(int))) {
+                printf("divergência: n = %d, %d threads\n", n, nthreads);
+                failed++;
+            }
+            checked++;
+        }
+        free(arr);
+        free(expected);
+    }
+
+    // Output: 48 casos, 0 divergências
+    printf("%d casos, %d divergências\n", checked, failed);
+    return failed != 0;
+}
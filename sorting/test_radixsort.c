@@ -0,0 +1,72 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "radixsort.c"
+#include "patterns.c"
+
+// Preenche o vetor com um padrão de entrada; os padrões 0, 2 e 3
+// exercitam os dígitos do radix sort.
+void fill(int *arr, int n, int kind) {
+    int i;
+
+    switch (kind) {
+        case 0:  // 32 bits aleatórios
+            for (i = 0; i < n; i++) arr[i] = (int) ((unsigned) rand() * 2654435761u);
+            break;
+        case 1: rangepattern(arr, n, -100, 100); break;
+        case 2:  // extremos
+            for (i = 0; i < n; i++) arr[i] = rand() % 2 ? INT_MIN + rand() % 3 : INT_MAX - rand() % 3;
+            break;
+        case 3:  // só um dígito varia
+            for (i = 0; i < n; i++) arr[i] = (rand() % 256) << 16;
+            break;
+        default: constpattern(arr, n, -5);  // todas as passadas puladas
+    }
+}
+
+// Compara radixsort com introsort.
+int main() {
+    int sizes[] = { 0, 1, 2, 100, 1000, 100000 };
+    int *arr, *expected, *tmp;
+    int s, kind, n, failed = 0, checked = 0;
+
+    srand(42);
+    for (s = 0; s < (int) (sizeof(sizes) / sizeof(sizes[0])); s++) {
+        n = sizes[s];
+        arr = (int *) malloc((n + 1) * sizeof(int));
+        expected = (int *) malloc((n + 1) * sizeof(int));
+        tmp = (int *) malloc((n + 1) * sizeof(int));
+
+        for (kind = 0; kind < 5; kind++) {
+            fill(expected, n, kind);
+            memcpy(arr, expected, n * sizeof(int));
+            introsort(expected, n);
+
+            // Alternando entre área auxiliar interna e do chamador.
+            if (kind % 2) radixsort(arr, n);
+            else radixsortbuf(arr, n, tmp);
+            if (memcmp(arr, expected, n * sizeof(int))) {
+                printf("divergência: n = %d, padrão %d\n", n, kind);
+                failed++;
+            }
+            checked++;
+        }
+        free(arr);
+        free(expected);
+        free(tmp);
+    }
+
+    // Output: 30 casos, 0 divergências
+    printf("%d casos, %d divergências\n", checked, failed);
+    return failed != 0;
+}
@@ -0,0 +1,88 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "simdsort.c"
+#define INTROSORT_BASECASE simdsort
+#define INTROSORT_CUTOFF 64
+#include "introsort.c"
+#include "patterns.c"
+
+// Preenche o vetor com um padrão de entrada.
+void fill(int *arr, int n, int kind) {
+    int i;
+
+    switch (kind) {
+        case 0: randompattern(arr, n); break;
+        case 1: rangepattern(arr, n, 0, 2); break;
+        case 2:  // só os extremos, para as comparações com sinal
+            for (i = 0; i < n; i++) arr[i] = rand() % 2 ? INT_MAX : INT_MIN;
+            break;
+        default: reversedpattern(arr, n);
+    }
+}
+
+// Confere se um kernel ordena igual a insertionsort.
+int check(const KernelSimd *k, int maxn) {
+    int arr[1024], expected[1024], bits;
+    int n, kind, failed = 0;
+
+    // Princípio 0-1: a rede ordena qualquer entrada se ordena
+    // todas as entradas de zeros e uns.
+    for (bits = 0; bits < (1 << k->width); bits++) {
+        for (n = 0; n < k->width; n++) arr[n] = (bits >> n) & 1;
+        k->sortblock(arr);
+        for (n = 1; n < k->width; n++) failed += arr[n - 1] > arr[n];
+    }
+
+    for (n = 0; n <= maxn; n++) {
+        for (kind = 0; kind < 4; kind++) {
+            fill(expected, n, kind);
+            memcpy(arr, expected, n * sizeof(int));
+            insertionsort(expected, n);
+            sortkernelsimd(k, arr, n);
+            failed += memcmp(arr, expected, n * sizeof(int)) != 0;
+        }
+    }
+    return failed;
+}
+
+int main() {
+    int *arr, *expected;
+    int i, n = 100000, failed;
+
+    srand(42);
+    printf("simdsort usa %s\n", simdsortisa());
+
+    // Output: escalar: 0 divergências (e o mesmo para sse4.1 e avx2, se suportados)
+    printf("escalar: %d divergências\n", check(&scalarsimd, 600));
+#ifdef SIMDSORT_X86
+    if (__builtin_cpu_supports("sse4.1")) printf("sse4.1: %d divergências\n", check(&sse41simd, 600));
+    if (__builtin_cpu_supports("avx2")) printf("avx2: %d divergências\n", check(&avx2simd, 600));
+#endif
+
+    // Introsort com simdsort como caso base.
+    // Output: introsort com caso base simdsort: 0 divergências
+    arr = (int *) malloc(n * sizeof(int));
+    expected = (int *) malloc(n * sizeof(int));
+    for (i = 0; i < n; i++) expected[i] = rand() % 1000;
+    memcpy(arr, expected, n * sizeof(int));
+    introsort(expected, n);
+    for (i = 1, failed = 0; i < n; i++) failed += expected[i - 1] > expected[i];
+    branchlessintrosort(arr, n);
+    failed += memcmp(arr, expected, n * sizeof(int)) != 0;
+    printf("introsort com caso base simdsort: %d divergências\n", failed);
+
+    free(arr);
+    free(expected);
+    return 0;
+}
@@ -0,0 +1,67 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "timsort.c"
+#include "patterns.c"
+
+// Preenche o vetor com um padrão de entrada.
+void fill(int *arr, int n, int kind) {
+    int i;
+
+    switch (kind) {
+        case 0: randompattern(arr, n); break;
+        case 1: rangepattern(arr, n, 0, 3); break;
+        case 2: nearlysortedpattern(arr, n, 100); break;
+        case 3: reversedpattern(arr, n); break;
+        case 4: constpattern(arr, n, 7); break;
+        case 5: organpattern(arr, n); break;
+        case 6:  // sequências alternadas, para a pilha de sequências
+            for (i = 0; i < n; i++) arr[i] = (i / 300) % 2 ? -i : i;
+            break;
+        default: tailpattern(arr, n, n / 50);
+    }
+}
+
+// Compara timsort com introsort em vetores de vários tamanhos e
+// padrões, incluindo vetores grandes o bastante para exercitar a
+// pilha de sequências e o galope.
+int main() {
+    int sizes[] = { 0, 1, 2, 3, 63, 64, 65, 1000, 4097, 100000, 1000003 };
+    int *arr, *expected;
+    int s, kind, n, failed = 0, checked = 0;
+
+    srand(42);
+    for (s = 0; s < (int) (sizeof(sizes) / sizeof(sizes[0])); s++) {
+        n = sizes[s];
+        arr = (int *) malloc((n + 1) * sizeof(int));
+        expected = (int *) malloc((n + 1) * sizeof(int));
+
+        for (kind = 0; kind < 8; kind++) {
+            fill(expected, n, kind);
+            memcpy(arr, expected, n * sizeof(int));
+
+            introsort(expected, n);
+            timsort(arr, n);
+            if (memcmp(arr, expected, n * sizeof(int))) {
+                printf("divergência: n = %d, padrão %d\n", n, kind);
+                failed++;
+            }
+            checked++;
+        }
+        free(arr);
+        free(expected);
+    }
+
+    // Output: 88 casos, 0 divergências
+    printf("%d casos, %d divergências\n", checked, failed);
+    return failed != 0;
+}
@@ -0,0 +1,482 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ * 
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ * 
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef TIMSORT_C
+#define TIMSORT_C
+
+#include <stdlib.h>
+#include <string.h>
+#include "introsort.c"
+
+// Vitórias seguidas de uma sequência antes de entrar em modo galope.
+#define TIMSORT_MINGALLOP 7
+
+// A pilha de sequências cresce no máximo log_phi(n): 85 basta
+// para qualquer n de 64 bits.
+#define TIMSORT_MAXSTACK 85
+
+/**
+ * Estado de uma ordenação.
+ * 
+ * Sequências pendentes em base/len, área auxiliar tmp (no máximo
+ * n / 2 elementos, alocada sob demanda) e o limiar de galope
+ * adaptativo.
+ */
+typedef struct {
+    int *arr, *tmp;
+    int n, tmpcap, mingallop, nruns;
+    int base[TIMSORT_MAXSTACK], len[TIMSORT_MAXSTACK];
+} StateTimsort;
+
+/**
+ * Tamanho mínimo de sequência: entre 32 e 64, tal que n / minrun
+ * seja uma potência de 2 ou um pouco menor.
+ */
+static int minruntim(int n) {
+    int r = 0;
+
+    while (n >= 64) {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+static void reversetim(int *a, int lo, int hi) {
+    int tmp;
+
+    for (hi--; lo < hi; lo++, hi--) {
+        tmp = a[lo];
+        a[lo] = a[hi];
+        a[hi] = tmp;
+    }
+}
+
+/**
+ * Tamanho da sequência que começa em lo.
+ * 
+ * Sequências estritamente decrescentes são invertidas; exigir
+ * decréscimo estrito mantém a estabilidade.
+ */
+static int countruntim(int *a, int lo, int hi) {
+    int run = lo + 1;
+
+    if (run == hi) return 1;
+    if (a[run++] < a[lo]) {
+        while (run < hi && a[run] < a[run - 1]) run++;
+        reversetim(a, lo, run);
+    }
+    else {
+        while (run < hi && a[run] >= a[run - 1]) run++;
+    }
+    return run - lo;
+}
+
+/**
+ * Insertion sort binário de a[lo..hi), com a[lo..start) já ordenado.
+ */
+static void binaryinsertiontim(int *a, int lo, int hi, int start) {
+    int left, right, mid, pivot;
+
+    for (; start < hi; start++) {
+        pivot = a[start];
+        left = lo;
+        right = start;
+        while (left < right) {
+            mid = left + (right - left) / 2;
+            if (pivot < a[mid]) right = mid;
+            else left = mid + 1;
+        }
+        memmove(a + left + 1, a + left, (start - left) * sizeof(int));
+        a[left] = pivot;
+    }
+}
+
+/**
+ * Posição mais à esquerda para inserir key em a[0..n) ordenado.
+ * 
+ * Galope exponencial a partir de hint seguido de busca binária:
+ * retorna k com a[k - 1] < key <= a[k].
+ */
+static int gallopleftim(int key, const int *a, int n, int hint) {
+    int last = 0, ofs = 1, maxofs, tmp, m;
+
+    if (key > a[hint]) {
+        maxofs = n - hint;
+        while (ofs < maxofs && key > a[hint + ofs]) {
+            last = ofs;
+            ofs = ofs < maxofs / 2 ? 2 * ofs + 1 : maxofs;
+        }
+        if (ofs > maxofs) ofs = maxofs;
+        last += hint;
+        ofs += hint;
+    }
+    else {
+        maxofs = hint + 1;
+        while (ofs < maxofs && key <= a[hint - ofs]) {
+            last = ofs;
+            ofs = ofs < maxofs / 2 ? 2 * ofs + 1 : maxofs;
+        }
+        if (ofs > maxofs) ofs = maxofs;
+        tmp = last;
+        last = hint - ofs;
+        ofs = hint - tmp;
+    }
+
+    for (last++; last < ofs; ) {
+        m = last + (ofs - last) / 2;
+        if (key > a[m]) last = m + 1;
+        else ofs = m;
+    }
+    return ofs;
+}
+
+/**
+ * Posição mais à direita para inserir key em a[0..n) ordenado.
+ * 
+ * Retorna k com a[k - 1] <= key < a[k].
+ */
+static int galloprightim(int key, const int *a, int n, int hint) {
+    int last = 0, ofs = 1, maxofs, tmp, m;
+
+    if (key < a[hint]) {
+        maxofs = hint + 1;
+        while (ofs < maxofs && key < a[hint - ofs]) {
+            last = ofs;
+            ofs = ofs < maxofs / 2 ? 2 * ofs + 1 : maxofs;
+        }
+        if (ofs > maxofs) ofs = maxofs;
+        tmp = last;
+        last = hint - ofs;
+        ofs = hint - tmp;
+    }
+    else {
+        maxofs = n - hint;
+        while (ofs < maxofs && key >= a[hint + ofs]) {
+            last = ofs;
+            ofs = ofs < maxofs / 2 ? 2 * ofs + 1 : maxofs;
+        }
+        if (ofs > maxofs) ofs = maxofs;
+        last += hint;
+        ofs += hint;
+    }
+
+    for (last++; last < ofs; ) {
+        m = last + (ofs - last) / 2;
+        if (key < a[m]) ofs = m;
+        else last = m + 1;
+    }
+    return ofs;
+}
+
+/**
+ * Garante área auxiliar com need elementos (need <= n / 2).
+ * 
+ * @return int 1 para sucesso, 0 caso a alocação falhe.
+ */
+static int ensuretim(StateTimsort *st, int need) {
+    int cap;
+
+    if (need <= st->tmpcap) return 1;
+    cap = need < st->n / 4 ? 2 * need : st->n / 2;
+    if (cap < need) cap = need;
+    free(st->tmp);
+    st->tmp = (int *) malloc(cap * sizeof(int));
+    st->tmpcap = st->tmp ? cap : 0;
+    return st->tmp != NULL;
+}
+
+/**
+ * Intercala a[base1..) e a[base2..) com len1 <= len2.
+ * 
+ * Copia a primeira sequência para tmp e intercala da esquerda para
+ * a direita. Quando uma das sequências vence TIMSORT_MINGALLOP
+ * vezes seguidas, passa a copiar blocos inteiros localizados por
+ * galope; o limiar se adapta ao sucesso do galope.
+ */
+static void mergelotim(StateTimsort *st, int base1, int len1, int base2, int len2) {
+    int *a = st->arr, *tmp = st->tmp;
+    int c1 = 0, c2 = base2, dest = base1;
+    int count1, count2, mingallop = st->mingallop;
+
+    memcpy(tmp, a + base1, len1 * sizeof(int));
+    a[dest++] = a[c2++];
+    if (--len2 == 0) {
+        memcpy(a + dest, tmp + c1, len1 * sizeof(int));
+        return;
+    }
+    if (len1 == 1) {
+        memmove(a + dest, a + c2, len2 * sizeof(int));
+        a[dest + len2] = tmp[c1];
+        return;
+    }
+
+    for (;;) {
+        count1 = count2 = 0;
+
+        // Um elemento por vez até uma sequência vencer seguidamente.
+        do {
+            if (a[c2] < tmp[c1]) {
+                a[dest++] = a[c2++];
+                count2++;
+                count1 = 0;
+                if (--len2 == 0) goto done;
+            }
+            else {
+                a[dest++] = tmp[c1++];
+                count1++;
+                count2 = 0;
+                if (--len1 == 1) goto done;
+            }
+        } while ((count1 | count2) < mingallop);
+
+        // Galope enquanto os blocos copiados forem grandes.
+        do {
+            count1 = galloprightim(a[c2], tmp + c1, len1, 0);
+            if (count1) {
+                memcpy(a + dest, tmp + c1, count1 * sizeof(int));
+                dest += count1;
+                c1 += count1;
+                len1 -= count1;
+                if (len1 <= 1) goto done;
+            }
+            a[dest++] = a[c2++];
+            if (--len2 == 0) goto done;
+
+            count2 = gallopleftim(tmp[c1], a + c2, len2, 0);
+            if (count2) {
+                memmove(a + dest, a + c2, count2 * sizeof(int));
+                dest += count2;
+                c2 += count2;
+                len2 -= count2;
+                if (len2 == 0) goto done;
+            }
+            a[dest++] = tmp[c1++];
+            if (--len1 == 1) goto done;
+            mingallop--;
+        } while (count1 >= TIMSORT_MINGALLOP || count2 >= TIMSORT_MINGALLOP);
+        if (mingallop < 0) mingallop = 0;
+        mingallop += 2;
+    }
+
+done:
+    st->mingallop = mingallop < 1 ? 1 : mingallop;
+    if (len1 == 1) {
+        memmove(a + dest, a + c2, len2 * sizeof(int));
+        a[dest + len2] = tmp[c1];
+    }
+    else memcpy(a + dest, tmp + c1, len1 * sizeof(int));
+}
+
+/**
+ * Intercala a[base1..) e a[base2..) com len1 > len2.
+ * 
+ * Simétrica a mergelotim: copia a segunda sequência para tmp e
+ * intercala da direita para a esquerda.
+ */
+static void mergehitim(StateTimsort *st, int base1, int len1, int base2, int len2) {
+    int *a = st->arr, *tmp = st->tmp;
+    int c1 = base1 + len1 - 1, c2 = len2 - 1, dest = base2 + len2 - 1;
+    int count1, count2, mingallop = st->mingallop;
+
+    memcpy(tmp, a + base2, len2 * sizeof(int));
+    a[dest--] = a[c1--];
+    if (--len1 == 0) {
+        memcpy(a + dest - (len2 - 1), tmp, len2 * sizeof(int));
+        return;
+    }
+    if (len2 == 1) {
+        dest -= len1;
+        c1 -= len1;
+        memmove(a + dest + 1, a + c1 + 1, len1 * sizeof(int));
+        a[dest] = tmp[c2];
+        return;
+    }
+
+    for (;;) {
+        count1 = count2 = 0;
+
+        do {
+            if (tmp[c2] < a[c1]) {
+                a[dest--] = a[c1--];
+                count1++;
+                count2 = 0;
+                if (--len1 == 0) goto done;
+            }
+            else {
+                a[dest--] = tmp[c2--];
+                count2++;
+                count1 = 0;
+                if (--len2 == 1) goto done;
+            }
+        } while ((count1 | count2) < mingallop);
+
+        do {
+            count1 = len1 - galloprightim(tmp[c2], a + base1, len1, len1 - 1);
+            if (count1) {
+                dest -= count1;
+                c1 -= count1;
+                len1 -= count1;
+                memmove(a + dest + 1, a + c1 + 1, count1 * sizeof(int));
+                if (len1 == 0) goto done;
+            }
+            a[dest--] = tmp[c2--];
+            if (--len2 == 1) goto done;
+
+            count2 = len2 - gallopleftim(a[c1], tmp, len2, len2 - 1);
+            if (count2) {
+                dest -= count2;
+                c2 -= count2;
+                len2 -= count2;
+                memcpy(a + dest + 1, tmp + c2 + 1, count2 * sizeof(int));
+                if (len2 <= 1) goto done;
+            }
+            a[dest--] = a[c1--];
+            if (--len1 == 0) goto done;
+            mingallop--;
+        } while (count1 >= TIMSORT_MINGALLOP || count2 >= TIMSORT_MINGALLOP);
+        if (mingallop < 0) mingallop = 0;
+        mingallop += 2;
+    }
+
+done:
+    st->mingallop = mingallop < 1 ? 1 : mingallop;
+    if (len2 == 1) {
+        dest -= len1;
+        c1 -= len1;
+        memmove(a + dest + 1, a + c1 + 1, len1 * sizeof(int));
+        a[dest] = tmp[c2];
+    }
+    else memcpy(a + dest - (len2 - 1), tmp, len2 * sizeof(int));
+}
+
+/**
+ * Intercala as sequências i e i + 1 da pilha.
+ * 
+ * Antes de intercalar, descarta o começo da primeira e o fim da
+ * segunda que já estão no lugar, localizados por galope.
+ * 
+ * @return int 1 para sucesso, 0 caso a alocação falhe.
+ */
+static int mergeattim(StateTimsort *st, int i) {
+    int *a = st->arr;
+    int base1 = st->base[i], len1 = st->len[i];
+    int base2 = st->base[i + 1], len2 = st->len[i + 1];
+    int k;
+
+    st->len[i] = len1 + len2;
+    if (i == st->nruns - 3) {
+        st->base[i + 1] = st->base[i + 2];
+        st->len[i + 1] = st->len[i + 2];
+    }
+    st->nruns--;
+
+    k = galloprightim(a[base2], a + base1, len1, 0);
+    base1 += k;
+    len1 -= k;
+    if (len1 == 0) return 1;
+
+    len2 = gallopleftim(a[base1 + len1 - 1], a + base2, len2, len2 - 1);
+    if (len2 == 0) return 1;
+
+    if (!ensuretim(st, len1 < len2 ? len1 : len2)) return 0;
+    if (len1 <= len2) mergelotim(st, base1, len1, base2, len2);
+    else mergehitim(st, base1, len1, base2, len2);
+    return 1;
+}
+
+/**
+ * Restaura os invariantes da pilha de sequências.
+ * 
+ * len[i - 2] > len[i - 1] + len[i] e len[i - 1] > len[i] para as
+ * quatro sequências do topo, o que mantém as intercalações
+ * equilibradas e a pilha com O(log n) sequências.
+ */
+static int collapsetim(StateTimsort *st) {
+    int *len = st->len, n;
+
+    while (st->nruns > 1) {
+        n = st->nruns - 2;
+        if ((n > 0 && len[n - 1] <= len[n] + len[n + 1]) ||
+            (n > 1 && len[n - 2] <= len[n - 1] + len[n])) {
+            if (len[n - 1] < len[n + 1]) n--;
+        }
+        else if (len[n] > len[n + 1]) break;
+        if (!mergeattim(st, n)) return 0;
+    }
+    return 1;
+}
+
+/**
+ * Intercala todas as sequências restantes.
+ */
+static int forcetim(StateTimsort *st) {
+    int n;
+
+    while (st->nruns > 1) {
+        n = st->nruns - 2;
+        if (n > 0 && st->len[n - 1] < st->len[n + 1]) n--;
+        if (!mergeattim(st, n)) return 0;
+    }
+    return 1;
+}
+
+/**
+ * Realiza ordenação de elementos em um vetor
+ * 
+ * Essa função realiza a ordenação dos elementos em um vetor
+ * utilizando o algoritmo TimSort: merge sort estável e adaptativo
+ * que aproveita sequências já ordenadas (crescentes, ou
+ * estritamente decrescentes, que são invertidas). Sequências
+ * curtas são estendidas com insertion sort binário e as
+ * intercalações usam galope. O(n) em vetores ordenados ou quase
+ * ordenados e O(n log n) no pior caso, com no máximo n / 2
+ * elementos de área auxiliar. Caso a alocação falhe, termina a
+ * ordenação com introsort.
+ * 
+ * @param arr int pointer contendo vetor
+ * @param n int do vetor arr
+ */
+void timsort(int *arr, int n) {
+    StateTimsort st;
+    int lo = 0, run, force, minrun, ok = 1;
+
+    if (n < 2) return;
+    if (n < 64) {
+        binaryinsertiontim(arr, 0, n, countruntim(arr, 0, n));
+        return;
+    }
+
+    st.arr = arr;
+    st.tmp = NULL;
+    st.n = n;
+    st.tmpcap = 0;
+    st.mingallop = TIMSORT_MINGALLOP;
+    st.nruns = 0;
+
+    minrun = minruntim(n);
+    while (ok && lo < n) {
+        run = countruntim(arr, lo, n);
+        if (run < minrun) {
+            force = n - lo < minrun ? n - lo : minrun;
+            binaryinsertiontim(arr, lo, lo + force, lo + run);
+            run = force;
+        }
+        st.base[st.nruns] = lo;
+        st.len[st.nruns] = run;
+        st.nruns++;
+        ok = collapsetim(&st);
+        lo += run;
+    }
+    if (ok) ok = forcetim(&st);
+
+    free(st.tmp);
+    if (!ok) branchlessintrosort(arr, n);
+}
+
+#endif
@@ -9,6 +9,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "stack.h"
+#include "../linkedlist/pfscan.h"
 
 /**
  * Cria cabeça de pilha.
@@ -204,4 +205,25 @@ int isinstack(Stack *stack, InfoStack *info) {
         ptr = ptr->next;
     }
     return 0;
+}
+
+/**
+ * Verifica presença de informação na pilha com prefetch.
+ * 
+ * Mesmo resultado de isinstack, pedindo ao processador a informação
+ * de cada nó dist nós antes da comparação. Os nós continuam sendo
+ * lidos um a um; ver linkedlist/pfscan.h.
+ * 
+ * @param stack ponteiro Stack da pilha.
+ * @param info ponteiro InfoStack com informação a ser buscada.
+ * @param dist distância de prefetch em nós, ou <= 0 para PFSCAN_DIST.
+ * @return int 1 caso exista na pilha, 0 caso contrário.
+ */
+int isinpfstack(Stack *stack, InfoStack *info, int dist) {
+    if (isemptystack(stack)) return 0;
+
+    PFSCAN(NodeStack, ptr, stack->first, NEXTPFSCAN, dist,
+        if (ptr->info->value == info->value) return 1;
+    );
+    return 0;
 }
\ No newline at end of file
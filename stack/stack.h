@@ -128,4 +128,18 @@ int lenstack(Stack *stack);
  */
 int isinstack(Stack *stack, InfoStack *info);
 
+/**
+ * Verifica presença de informação na pilha com prefetch.
+ * 
+ * Mesmo resultado de isinstack, pedindo ao processador a informação
+ * de cada nó dist nós antes da comparação. Os nós continuam sendo
+ * lidos um a um; ver linkedlist/pfscan.h.
+ * 
+ * @param stack ponteiro Stack da pilha.
+ * @param info ponteiro InfoStack com informação a ser buscada.
+ * @param dist distância de prefetch em nós, ou <= 0 para PFSCAN_DIST.
+ * @return int 1 caso exista na pilha, 0 caso contrário.
+ */
+int isinpfstack(Stack *stack, InfoStack *info, int dist);
+
 #endif
\ No newline at end of file
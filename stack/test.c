@@ -37,5 +37,9 @@ int main() {
     if (isinstack(stack, info1)) printf("\nEstá contido na pilha.\n");
     else printf("\nNão está na pilha.\n");
 
+    // Mesma verificação com prefetch de 4 nós à frente
+    if (isinpfstack(stack, info1, 4)) printf("\nEstá contido na pilha.\n");
+    else printf("\nNão está na pilha.\n");
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,46 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#include <stdio.h>
+#include "threadpool.h"
+
+#define NTASKS 1000
+
+pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+long total;
+
+// Soma os inteiros de 1 a *arg.
+void task(void *arg) {
+    long i, sum = 0;
+
+    for (i = 1; i <= *(int *) arg; i++) sum += i;
+    pthread_mutex_lock(&lock);
+    total += sum;
+    pthread_mutex_unlock(&lock);
+}
+
+// dummy test
+int main() {
+    ThreadPool *pool = createpool(4);
+    int args[NTASKS], i;
+
+    // Output: 4 threads
+    printf("%d threads\n", lenpool(pool));
+
+    // Envia mais tarefas do que a capacidade inicial da fila.
+    // Output: total: 166666500
+    for (i = 0; i < NTASKS; i++) {
+        args[i] = i;
+        submitpool(pool, task, &args[i]);
+    }
+    waitpool(pool);
+    printf("total: %ld\n", total);
+
+    destroypool(pool);
+    return 0;
+}
@@ -0,0 +1,184 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <unistd.h>
+#include "threadpool.h"
+
+/**
+ * Laço das threads do pool.
+ *
+ * Retira tarefas da fila até o pool ser encerrado e a fila
+ * esvaziar.
+ *
+ * @param arg ponteiro ThreadPool do pool.
+ * @return void* sempre NULL.
+ */
+static void *workerpool(void *arg) {
+    ThreadPool *pool = (ThreadPool *) arg;
+    TaskPool task;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (pool->count == 0 && !pool->stop) pthread_cond_wait(&pool->work, &pool->lock);
+        if (pool->count == 0) break;
+
+        task = pool->tasks[pool->head];
+        pool->head = (pool->head + 1) % pool->capacity;
+        pool->count--;
+
+        pthread_mutex_unlock(&pool->lock);
+        task.fn(task.arg);
+        pthread_mutex_lock(&pool->lock);
+
+        if (--pool->pending == 0) pthread_cond_broadcast(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+/**
+ * Cria pool de threads.
+ *
+ * @param nthreads quantidade de threads, ou <= 0 para uma por
+ *                 processador disponível.
+ * @return ThreadPool* pointer para pool criado, ou NULL caso falhe.
+ */
+ThreadPool *createpool(int nthreads) {
+    ThreadPool *pool;
+    int i;
+
+    if (nthreads <= 0) nthreads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    if (nthreads <= 0) nthreads = 1;
+
+    pool = (ThreadPool *) malloc(sizeof(ThreadPool));
+    if (!pool) return NULL;
+
+    pool->threads = (pthread_t *) malloc(nthreads * sizeof(pthread_t));
+    pool->capacity = 64;
+    pool->tasks = (TaskPool *) malloc(pool->capacity * sizeof(TaskPool));
+    if (!pool->threads || !pool->tasks) {
+        free(pool->threads);
+        free(pool->tasks);
+        free(pool);
+        return NULL;
+    }
+
+    pool->head = pool->count = 0;
+    pool->pending = pool->stop = 0;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    for (i = 0; i < nthreads; i++) {
+        if (pthread_create(&pool->threads[i], NULL, workerpool, pool) != 0) break;
+    }
+    pool->nthreads = i;
+    if (i == 0) {
+        destroypool(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+/**
+ * Destroi pool de threads.
+ *
+ * Aguarda as tarefas pendentes, encerra as threads e libera
+ * a memória do pool.
+ *
+ * @param pool ponteiro ThreadPool do pool.
+ */
+void destroypool(ThreadPool *pool) {
+    int i;
+
+    if (!pool) return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (i = 0; i < pool->nthreads; i++) pthread_join(pool->threads[i], NULL);
+
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->work);
+    pthread_cond_destroy(&pool->done);
+    free(pool->threads);
+    free(pool->tasks);
+    free(pool);
+}
+
+/**
+ * Envia tarefa ao pool.
+ *
+ * A tarefa é executada por alguma das threads do pool, em
+ * ordem de chegada.
+ *
+ * @param pool ponteiro ThreadPool do pool.
+ * @param fn função a ser executada.
+ * @param arg ponteiro repassado a fn.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int submitpool(ThreadPool *pool, void (*fn)(void *), void *arg) {
+    TaskPool *tasks;
+    int i;
+
+    if (!pool || !fn) return 0;
+
+    pthread_mutex_lock(&pool->lock);
+    if (pool->count == pool->capacity) {
+        tasks = (TaskPool *) malloc(2 * pool->capacity * sizeof(TaskPool));
+        if (!tasks) {
+            pthread_mutex_unlock(&pool->lock);
+            return 0;
+        }
+        for (i = 0; i < pool->count; i++) tasks[i] = pool->tasks[(pool->head + i) % pool->capacity];
+        free(pool->tasks);
+        pool->tasks = tasks;
+        pool->head = 0;
+        pool->capacity *= 2;
+    }
+
+    pool->tasks[(pool->head + pool->count) % pool->capacity].fn = fn;
+    pool->tasks[(pool->head + pool->count) % pool->capacity].arg = arg;
+    pool->count++;
+    pool->pending++;
+    pthread_cond_signal(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+    return 1;
+}
+
+/**
+ * Aguarda conclusão das tarefas.
+ *
+ * Bloqueia até que todas as tarefas enviadas ao pool, inclusive
+ * as de outras threads, tenham terminado.
+ *
+ * @param pool ponteiro ThreadPool do pool.
+ */
+void waitpool(ThreadPool *pool) {
+    if (!pool) return;
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending > 0) pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/**
+ * Ver quantidade de threads do pool.
+ *
+ * @param pool ponteiro ThreadPool do pool.
+ * @return int quantidade de threads, -1 caso pool não exista.
+ */
+int lenpool(ThreadPool *pool) {
+    if (!pool) return -1;
+    return pool->nthreads;
+}
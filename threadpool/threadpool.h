@@ -0,0 +1,86 @@
+/**
+ * CStruct (C) 2019-2021 https://github.com/henriquerubia/cstruct
+ *
+ * @author Carlos Henrique Rubia Barbosa <carlos.h.barbosa@edu.ufes.br>
+ *
+ * See LICENSE for terms and licensing notice.
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <pthread.h>
+
+/**
+ * Estruturas de dados
+ *
+ * Conjunto fixo de threads que executam tarefas retiradas de uma
+ * fila circular. Cada tarefa é uma função e seu argumento.
+ */
+
+typedef struct {
+    void (*fn)(void *);
+    void *arg;
+} TaskPool;
+
+typedef struct {
+    pthread_t *threads;
+    int nthreads;
+    TaskPool *tasks;
+    int head, count, capacity;
+    int pending, stop;
+    pthread_mutex_t lock;
+    pthread_cond_t work, done;
+} ThreadPool;
+
+/**
+ * Cria pool de threads.
+ *
+ * @param nthreads quantidade de threads, ou <= 0 para uma por
+ *                 processador disponível.
+ * @return ThreadPool* pointer para pool criado, ou NULL caso falhe.
+ */
+ThreadPool *createpool(int nthreads);
+
+/**
+ * Destroi pool de threads.
+ *
+ * Aguarda as tarefas pendentes, encerra as threads e libera
+ * a memória do pool.
+ *
+ * @param pool ponteiro ThreadPool do pool.
+ */
+void destroypool(ThreadPool *pool);
+
+/**
+ * Envia tarefa ao pool.
+ *
+ * A tarefa é executada por alguma das threads do pool, em
+ * ordem de chegada.
+ *
+ * @param pool ponteiro ThreadPool do pool.
+ * @param fn função a ser executada.
+ * @param arg ponteiro repassado a fn.
+ * @return int 1 para sucesso, 0 caso contrário.
+ */
+int submitpool(ThreadPool *pool, void (*fn)(void *), void *arg);
+
+/**
+ * Aguarda conclusão das tarefas.
+ *
+ * Bloqueia até que todas as tarefas enviadas ao pool, inclusive
+ * as de outras threads, tenham terminado.
+ *
+ * @param pool ponteiro ThreadPool do pool.
+ */
+void waitpool(ThreadPool *pool);
+
+/**
+ * Ver quantidade de threads do pool.
+ *
+ * @param pool ponteiro ThreadPool do pool.
+ * @return int quantidade de threads, -1 caso pool não exista.
+ */
+int lenpool(ThreadPool *pool);
+
+#endif